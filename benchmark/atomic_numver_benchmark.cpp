@@ -0,0 +1,83 @@
+#include <arba/vrsn/atomic_numver.hpp>
+#include <benchmark/benchmark.h>
+
+#include <mutex>
+
+// Contention on a version shared by 1 to 64 threads: atomic_numver against a numver guarded by a mutex.
+// Each thread increments the shared version (or reads it) in a loop.
+
+namespace
+{
+
+struct mutex_numver
+{
+    mutable std::mutex mutex;
+    vrsn::numver version;
+
+    vrsn::numver fetch_up_patch()
+    {
+        const std::lock_guard lock(mutex);
+        const vrsn::numver previous = version;
+        version.up_patch();
+        return previous;
+    }
+
+    vrsn::numver load() const
+    {
+        const std::lock_guard lock(mutex);
+        return version;
+    }
+};
+
+vrsn::atomic_numver shared_atomic_numver;
+mutex_numver shared_mutex_numver;
+
+void BM_atomic_numver_fetch_up_patch(benchmark::State& state)
+{
+    if (state.thread_index() == 0)
+        shared_atomic_numver.store(vrsn::numver());
+    for (auto _ : state)
+        benchmark::DoNotOptimize(shared_atomic_numver.fetch_up_patch());
+    state.SetItemsProcessed(state.iterations());
+    state.counters["lock_free"] = vrsn::atomic_numver::is_always_lock_free;
+}
+BENCHMARK(BM_atomic_numver_fetch_up_patch)->ThreadRange(1, 64)->UseRealTime();
+
+void BM_mutex_numver_up_patch(benchmark::State& state)
+{
+    if (state.thread_index() == 0)
+        shared_mutex_numver.version = vrsn::numver();
+    for (auto _ : state)
+        benchmark::DoNotOptimize(shared_mutex_numver.fetch_up_patch());
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_mutex_numver_up_patch)->ThreadRange(1, 64)->UseRealTime();
+
+// Mixed traffic: one thread increments, the others read.
+void BM_atomic_numver_load_while_updated(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        if (state.thread_index() == 0)
+            benchmark::DoNotOptimize(shared_atomic_numver.fetch_up_patch());
+        else
+            benchmark::DoNotOptimize(shared_atomic_numver.load(std::memory_order_acquire));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_atomic_numver_load_while_updated)->ThreadRange(1, 64)->UseRealTime();
+
+void BM_mutex_numver_load_while_updated(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        if (state.thread_index() == 0)
+            benchmark::DoNotOptimize(shared_mutex_numver.fetch_up_patch());
+        else
+            benchmark::DoNotOptimize(shared_mutex_numver.load());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_mutex_numver_load_while_updated)->ThreadRange(1, 64)->UseRealTime();
+
+} // namespace
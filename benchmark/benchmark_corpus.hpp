@@ -0,0 +1,46 @@
+#pragma once
+
+#include <arba/vrsn/corpus_generator.hpp>
+#include <arba/vrsn/semver.hpp>
+#include <arba/vrsn/semver_view.hpp>
+
+#include <map>
+#include <string>
+#include <vector>
+
+// Inputs shared by the benchmarks: generated once per size (npm-like profile, fixed seed, no invalid version).
+
+inline const std::vector<std::string>& benchmark_corpus(std::size_t count)
+{
+    static std::map<std::size_t, std::vector<std::string>> corpora;
+    auto iter = corpora.find(count);
+    if (iter == corpora.end())
+    {
+        vrsn::corpus_profile profile = vrsn::corpus_profile::npm_like();
+        profile.invalid_ratio = 0;
+        vrsn::corpus_generator generator(profile, 42);
+        iter = corpora.emplace(count, generator.generate(count)).first;
+    }
+    return iter->second;
+}
+
+inline std::vector<vrsn::semver> benchmark_semvers(std::size_t count)
+{
+    std::vector<vrsn::semver> versions;
+    versions.reserve(count);
+    for (const std::string& version : benchmark_corpus(count))
+        versions.emplace_back(version);
+    return versions;
+}
+
+// The corpus as a text of one version per line.
+inline std::string benchmark_corpus_text(std::size_t count)
+{
+    std::string text;
+    for (const std::string& version : benchmark_corpus(count))
+    {
+        text += version;
+        text += '\n';
+    }
+    return text;
+}
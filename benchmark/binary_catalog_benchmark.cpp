@@ -0,0 +1,108 @@
+#include "benchmark_corpus.hpp"
+
+#include <arba/vrsn/binary_catalog.hpp>
+#include <arba/vrsn/io/mapped_file.hpp>
+#include <benchmark/benchmark.h>
+
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
+// Load time of a catalog of package versions: parsing a text file ("package version" lines) into semvers against
+// mapping a binary catalog. Argument: number of versions.
+
+namespace
+{
+
+constexpr std::size_t package_count = 1000;
+
+struct catalog_files
+{
+    std::filesystem::path text_path;
+    std::filesystem::path binary_path;
+};
+
+const catalog_files& benchmark_catalog_files(std::size_t count)
+{
+    static std::map<std::size_t, catalog_files> files;
+    auto iter = files.find(count);
+    if (iter != files.end())
+        return iter->second;
+
+    const std::filesystem::path directory = std::filesystem::temp_directory_path();
+    catalog_files paths{ directory / ("arba-vrsn-catalog-" + std::to_string(count) + ".txt"),
+                         directory / ("arba-vrsn-catalog-" + std::to_string(count) + ".bin") };
+    std::ofstream text(paths.text_path, std::ios::binary);
+    vrsn::binary_catalog_writer writer;
+    const std::vector<std::string>& corpus = benchmark_corpus(count);
+    for (std::size_t index = 0; index < corpus.size(); ++index)
+    {
+        const std::string package = "package-" + std::to_string(index % package_count);
+        text << package << ' ' << corpus[index] << '\n';
+        writer.add(package, vrsn::semver(corpus[index]));
+    }
+    writer.write(paths.binary_path);
+    return files.emplace(count, std::move(paths)).first->second;
+}
+
+void BM_load_text_catalog(benchmark::State& state)
+{
+    const catalog_files& files = benchmark_catalog_files(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        const vrsn::mapped_file file(files.text_path);
+        std::map<std::string, std::vector<vrsn::semver>, std::less<>> catalog;
+        std::string_view text(reinterpret_cast<const char*>(file.bytes().data()), file.size());
+        while (!text.empty())
+        {
+            const std::size_t eol = text.find('\n');
+            const std::string_view line = text.substr(0, eol);
+            text.remove_prefix(eol == std::string_view::npos ? text.size() : eol + 1);
+            const std::size_t space = line.find(' ');
+            auto package = catalog.find(line.substr(0, space));
+            if (package == catalog.end())
+                package = catalog.emplace(std::string(line.substr(0, space)), std::vector<vrsn::semver>()).first;
+            package->second.emplace_back(line.substr(space + 1));
+        }
+        benchmark::DoNotOptimize(catalog.size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_load_text_catalog)->Arg(100'000)->Arg(1'000'000)->Unit(benchmark::kMillisecond);
+
+// Opening costs the same whatever the catalog size.
+void BM_open_binary_catalog(benchmark::State& state)
+{
+    const catalog_files& files = benchmark_catalog_files(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        const vrsn::mapped_file file(files.binary_path);
+        const vrsn::binary_catalog_view catalog(file.bytes());
+        benchmark::DoNotOptimize(catalog.find("package-42")->back());
+    }
+}
+BENCHMARK(BM_open_binary_catalog)->Arg(100'000)->Arg(1'000'000)->Unit(benchmark::kMicrosecond);
+
+// Opening, then reading every version once (pages are faulted in).
+void BM_open_and_scan_binary_catalog(benchmark::State& state)
+{
+    const catalog_files& files = benchmark_catalog_files(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        const vrsn::mapped_file file(files.binary_path);
+        const vrsn::binary_catalog_view catalog(file.bytes());
+        std::size_t pre_release_count = 0;
+        for (std::size_t index = 0; index < catalog.package_count(); ++index)
+        {
+            for (const vrsn::semver_view version : catalog.package(index))
+                pre_release_count += !version.pre_release().empty();
+        }
+        benchmark::DoNotOptimize(pre_release_count);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_open_and_scan_binary_catalog)->Arg(100'000)->Arg(1'000'000)->Unit(benchmark::kMillisecond);
+
+} // namespace
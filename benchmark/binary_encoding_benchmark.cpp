@@ -0,0 +1,153 @@
+#include "benchmark_corpus.hpp"
+
+#include <arba/vrsn/binary_encoding.hpp>
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <format>
+#include <iterator>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Serialization throughput: the binary encoding of versions against their text form (std::format, then parsing the
+// text again). Argument: number of versions.
+
+namespace
+{
+
+constexpr std::size_t version_count = 100'000;
+
+std::vector<std::byte> encode_all(const std::vector<vrsn::semver>& versions)
+{
+    std::size_t size = 0;
+    for (const vrsn::semver& version : versions)
+        size += vrsn::encoded_size(version);
+    std::vector<std::byte> bytes(size);
+    std::size_t pos = 0;
+    for (const vrsn::semver& version : versions)
+        pos += vrsn::encode_to(std::span(bytes).subspan(pos), version).size;
+    return bytes;
+}
+
+void BM_binary_encode(benchmark::State& state)
+{
+    const std::vector<vrsn::semver> versions = benchmark_semvers(static_cast<std::size_t>(state.range(0)));
+    std::vector<std::byte> bytes(encode_all(versions).size());
+    for (auto _ : state)
+    {
+        std::size_t pos = 0;
+        for (const vrsn::semver& version : versions)
+            pos += vrsn::encode_to(std::span(bytes).subspan(pos), version).size;
+        benchmark::DoNotOptimize(bytes.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(bytes.size()));
+}
+BENCHMARK(BM_binary_encode)->Arg(version_count);
+
+void BM_text_format(benchmark::State& state)
+{
+    const std::vector<vrsn::semver> versions = benchmark_semvers(static_cast<std::size_t>(state.range(0)));
+    std::string text;
+    text.reserve(benchmark_corpus_text(static_cast<std::size_t>(state.range(0))).size());
+    for (auto _ : state)
+    {
+        text.clear();
+        for (const vrsn::semver& version : versions)
+            std::format_to(std::back_inserter(text), "{}\n", version);
+        benchmark::DoNotOptimize(text.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(text.size()));
+}
+BENCHMARK(BM_text_format)->Arg(version_count);
+
+void BM_binary_decode_semver(benchmark::State& state)
+{
+    const std::vector<std::byte> bytes = encode_all(benchmark_semvers(static_cast<std::size_t>(state.range(0))));
+    std::vector<vrsn::semver> versions;
+    versions.reserve(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        versions.clear();
+        for (std::size_t pos = 0; pos < bytes.size();)
+        {
+            vrsn::semver version(0, 0, 0);
+            pos += vrsn::decode_from(std::span(bytes).subspan(pos), version).size;
+            versions.push_back(std::move(version));
+        }
+        benchmark::DoNotOptimize(versions.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(bytes.size()));
+}
+BENCHMARK(BM_binary_decode_semver)->Arg(version_count);
+
+void BM_text_parse_semver(benchmark::State& state)
+{
+    const std::string text = benchmark_corpus_text(static_cast<std::size_t>(state.range(0)));
+    std::vector<vrsn::semver> versions;
+    versions.reserve(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        versions.clear();
+        for (std::size_t pos = 0; pos < text.size();)
+        {
+            const std::size_t eol = text.find('\n', pos);
+            versions.emplace_back(std::string_view(text).substr(pos, eol - pos));
+            pos = eol + 1;
+        }
+        benchmark::DoNotOptimize(versions.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(text.size()));
+}
+BENCHMARK(BM_text_parse_semver)->Arg(version_count);
+
+// The views refer to the input: neither side allocates.
+void BM_binary_decode_semver_view(benchmark::State& state)
+{
+    const std::vector<std::byte> bytes = encode_all(benchmark_semvers(static_cast<std::size_t>(state.range(0))));
+    std::vector<vrsn::semver_view> versions;
+    versions.reserve(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        versions.clear();
+        for (std::size_t pos = 0; pos < bytes.size();)
+        {
+            vrsn::semver_view version;
+            pos += vrsn::decode_from(std::span(bytes).subspan(pos), version).size;
+            versions.push_back(version);
+        }
+        benchmark::DoNotOptimize(versions.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(bytes.size()));
+}
+BENCHMARK(BM_binary_decode_semver_view)->Arg(version_count);
+
+void BM_text_parse_semver_view(benchmark::State& state)
+{
+    const std::string text = benchmark_corpus_text(static_cast<std::size_t>(state.range(0)));
+    std::vector<vrsn::semver_view> versions;
+    versions.reserve(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        versions.clear();
+        for (std::size_t pos = 0; pos < text.size();)
+        {
+            const std::size_t eol = text.find('\n', pos);
+            versions.emplace_back(std::string_view(text).substr(pos, eol - pos));
+            pos = eol + 1;
+        }
+        benchmark::DoNotOptimize(versions.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(text.size()));
+}
+BENCHMARK(BM_text_parse_semver_view)->Arg(version_count);
+
+} // namespace
@@ -0,0 +1,116 @@
+#include "benchmark_corpus.hpp"
+
+#include <arba/vrsn/parallel_algorithm.hpp>
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <span>
+#include <vector>
+
+// Scaling of parallel_sort + parallel_unique and parallel_max against std::sort + std::unique and std::max_element.
+// Arguments: number of versions, number of threads.
+
+namespace
+{
+
+void thread_count_args(benchmark::internal::Benchmark* benchmark)
+{
+    for (int64_t size : { 100'000, 1'000'000 })
+    {
+        for (int64_t thread_count : { 1, 2, 4, 8, 16 })
+            benchmark->Args({ size, thread_count });
+    }
+}
+
+void BM_std_sort_unique(benchmark::State& state)
+{
+    const std::vector<vrsn::semver> input = benchmark_semvers(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        std::vector<vrsn::semver> versions = input;
+        state.ResumeTiming();
+        std::sort(versions.begin(), versions.end());
+        versions.erase(std::unique(versions.begin(), versions.end()), versions.end());
+        benchmark::DoNotOptimize(versions.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_std_sort_unique)->Arg(100'000)->Arg(1'000'000)->Unit(benchmark::kMillisecond);
+
+void BM_parallel_sort_unique(benchmark::State& state)
+{
+    const std::vector<vrsn::semver> input = benchmark_semvers(static_cast<std::size_t>(state.range(0)));
+    const vrsn::parallel_options options{ .thread_count = static_cast<unsigned>(state.range(1)) };
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        std::vector<vrsn::semver> versions = input;
+        state.ResumeTiming();
+        vrsn::parallel_sort(std::span(versions), std::less<>(), options);
+        const std::size_t size = vrsn::parallel_unique(std::span(versions), vrsn::unique_mode::precedence, options);
+        versions.erase(versions.begin() + static_cast<std::ptrdiff_t>(size), versions.end());
+        benchmark::DoNotOptimize(versions.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_parallel_sort_unique)->Apply(thread_count_args)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+void BM_std_sort_numver(benchmark::State& state)
+{
+    std::vector<vrsn::numver> input;
+    for (const vrsn::semver& version : benchmark_semvers(static_cast<std::size_t>(state.range(0))))
+        input.push_back(version.core());
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        std::vector<vrsn::numver> versions = input;
+        state.ResumeTiming();
+        std::sort(versions.begin(), versions.end());
+        benchmark::DoNotOptimize(versions.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_std_sort_numver)->Arg(1'000'000)->Unit(benchmark::kMillisecond);
+
+void BM_parallel_sort_numver(benchmark::State& state)
+{
+    std::vector<vrsn::numver> input;
+    for (const vrsn::semver& version : benchmark_semvers(static_cast<std::size_t>(state.range(0))))
+        input.push_back(version.core());
+    const vrsn::parallel_options options{ .thread_count = static_cast<unsigned>(state.range(1)) };
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        std::vector<vrsn::numver> versions = input;
+        state.ResumeTiming();
+        vrsn::parallel_sort(std::span(versions), std::less<>(), options);
+        benchmark::DoNotOptimize(versions.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_parallel_sort_numver)
+    ->ArgsProduct({ { 1'000'000 }, { 1, 2, 4, 8, 16 } })
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+void BM_std_max_element(benchmark::State& state)
+{
+    const std::vector<vrsn::semver> versions = benchmark_semvers(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state)
+        benchmark::DoNotOptimize(std::max_element(versions.begin(), versions.end()));
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_std_max_element)->Arg(100'000)->Arg(1'000'000)->Unit(benchmark::kMillisecond);
+
+void BM_parallel_max(benchmark::State& state)
+{
+    std::vector<vrsn::semver> versions = benchmark_semvers(static_cast<std::size_t>(state.range(0)));
+    const vrsn::parallel_options options{ .thread_count = static_cast<unsigned>(state.range(1)) };
+    for (auto _ : state)
+        benchmark::DoNotOptimize(vrsn::parallel_max(std::span(versions), options));
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_parallel_max)->Apply(thread_count_args)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+} // namespace
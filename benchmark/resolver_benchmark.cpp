@@ -0,0 +1,53 @@
+#include <arba/vrsn/resolver.hpp>
+#include <benchmark/benchmark.h>
+
+#include <format>
+#include <string>
+#include <vector>
+
+// Resolution time of a synthetic package graph. Argument: number of packages.
+
+namespace
+{
+
+// Package i has versions 1.0.0 to 1.9.0, and version 1.m.0 depends on packages 2i+1 and 2i+2 (a binary tree) with
+// ranges excluding their greatest versions when m is odd: the greatest version of the root, 1.9.0, rules out the
+// greatest version of its whole subtree.
+vrsn::memory_package_provider make_package_graph(std::size_t package_count)
+{
+    vrsn::memory_package_provider provider;
+    const auto name = [](std::size_t i) { return std::format("pkg{}", i); };
+    for (std::size_t i = 0; i < package_count; ++i)
+    {
+        for (uint32_t minor = 0; minor < 10; ++minor)
+        {
+            std::vector<vrsn::dependency> dependencies;
+            for (std::size_t child : { 2 * i + 1, 2 * i + 2 })
+            {
+                if (child >= package_count)
+                    continue;
+                const vrsn::semver upper = minor % 2 ? vrsn::semver(1, 9, 0) : vrsn::semver(2, 0, 0);
+                dependencies.push_back({ name(child), vrsn::version_range::between(vrsn::semver(1, 0, 0), upper) });
+            }
+            provider.add(name(i), vrsn::semver(1, minor, 0), std::move(dependencies));
+        }
+    }
+    return provider;
+}
+
+void BM_resolve_package_graph(benchmark::State& state)
+{
+    const std::size_t package_count = static_cast<std::size_t>(state.range(0));
+    const vrsn::memory_package_provider provider = make_package_graph(package_count);
+    for (auto _ : state)
+    {
+        const vrsn::resolution result = vrsn::resolve(provider, "pkg0", vrsn::semver(1, 9, 0));
+        if (result.size() != package_count)
+            state.SkipWithError("Some packages were not selected.");
+        benchmark::DoNotOptimize(result.size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_resolve_package_graph)->Arg(1'000)->Arg(10'000)->Unit(benchmark::kMillisecond);
+
+} // namespace
@@ -35,7 +35,7 @@ class ArbaVrsnRecipe(ConanFile):
     no_copy_source = True
 
     # Sources
-    exports_sources = "LICENSE.md", "CMakeLists.txt", "test/*", "include/*", "external/*", "cmake/*"
+    exports_sources = "LICENSE.md", "CMakeLists.txt", "test/*", "include/*", "module/*", "external/*", "cmake/*"
 
     # Other
     implements = ["auto_header_only"]
@@ -80,3 +80,7 @@ class ArbaVrsnRecipe(ConanFile):
         self.cpp_info.bindirs = []
         self.cpp_info.libdirs = []
         self.cpp_info.set_property("cmake_target_name", self.name.replace('-', '::'))
+        if self.settings.os in ["Linux", "FreeBSD"]:
+            self.cpp_info.system_libs = ["pthread"]
+        if self.settings.os == "Linux":
+            self.cpp_info.system_libs.append("dl")
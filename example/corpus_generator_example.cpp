@@ -0,0 +1,33 @@
+#include <arba/vrsn/corpus_generator.hpp>
+#include <cstdlib>
+#include <iostream>
+#include <string_view>
+
+// Usage: corpus_generator_example [npm|cargo|nightly] [count] [seed] [output_file]
+// Without output file, the corpus is written on the standard output.
+int main(int argc, char** argv)
+{
+    const std::string_view profile_name = argc > 1 ? argv[1] : "npm";
+    const std::size_t count = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 100;
+    const uint64_t seed = argc > 3 ? std::strtoull(argv[3], nullptr, 10) : 0;
+
+    vrsn::corpus_profile profile;
+    if (profile_name == "npm")
+        profile = vrsn::corpus_profile::npm_like();
+    else if (profile_name == "cargo")
+        profile = vrsn::corpus_profile::cargo_like();
+    else if (profile_name == "nightly")
+        profile = vrsn::corpus_profile::ci_nightly_like();
+    else
+    {
+        std::cerr << "Unknown profile: " << profile_name << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    vrsn::corpus_generator generator(profile, seed);
+    if (argc > 4)
+        generator.write(std::filesystem::path(argv[4]), count);
+    else
+        generator.write(std::cout, count);
+    return EXIT_SUCCESS;
+}
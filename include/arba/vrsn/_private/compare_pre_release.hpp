@@ -0,0 +1,121 @@
+#pragma once
+
+#include "extract_numver.hpp"
+
+#include <string_view>
+
+inline namespace arba
+{
+namespace vrsn
+{
+namespace private_
+{
+
+// Precedence of two numeric identifiers (digits without leading zero), of any length: the shortest one is the
+// smallest, and identifiers of equal length compare as strings.
+[[nodiscard]] constexpr bool numeric_identifier_is_less_than_(std::string_view left_id, std::string_view right_id)
+{
+    return left_id.size() < right_id.size() || (left_id.size() == right_id.size() && left_id < right_id);
+}
+
+// Precedence of two valid pre-release strings (https://semver.org/spec/v2.0.0.html#spec-item-11).
+// An empty pre-release has a higher precedence than any non-empty one.
+[[nodiscard]] constexpr bool pre_release_is_less_than_(std::string_view left_pr, std::string_view right_pr)
+{
+    if (left_pr.empty())
+        return false;
+    else if (right_pr.empty())
+        return true;
+
+    bool left_is_shortest = false;
+    bool left_is_num = true;
+    bool right_is_num = true;
+
+    const auto left_end_iter = left_pr.end();
+    const auto right_end_iter = right_pr.end();
+    auto left_iter = left_pr.begin();
+    auto right_iter = right_pr.begin();
+    char left_ch = '\0';
+    char right_ch = '\0';
+
+    auto left_part_iter = left_iter;
+    auto right_part_iter = right_iter;
+
+    for (;;)
+    {
+        if (left_iter == left_end_iter)
+        {
+            if (right_iter == right_end_iter)
+                return false;
+            left_is_shortest = true;
+            break;
+        }
+        else if (right_iter == right_end_iter)
+            break;
+
+        left_ch = *left_iter;
+        right_ch = *right_iter;
+        if (left_ch != right_ch)
+            break;
+
+        ++left_iter, ++right_iter;
+        if (left_ch == '.')
+        {
+            left_is_num = true;
+            left_part_iter = left_iter;
+            right_part_iter = right_iter;
+            // save first char pos of the part.
+        }
+        else
+            left_is_num = left_is_num && is_digit_(left_ch);
+    }
+
+    right_is_num = left_is_num;
+    bool left_is_lt = left_ch < right_ch;
+    bool length_break = true;
+
+    if (left_ch != right_ch)
+    {
+        length_break = false;
+        left_is_num = left_is_num && is_digit_(left_ch);
+        right_is_num = right_is_num && is_digit_(right_ch);
+        if (!left_is_num && !right_is_num)
+            return left_is_lt;
+    }
+    else if (!left_is_num && !right_is_num)
+    {
+        return left_is_shortest;
+    }
+
+    for (; left_iter != left_end_iter && left_is_num; ++left_iter)
+    {
+        left_ch = *left_iter;
+        if (left_ch == '.')
+            break;
+        left_is_num = left_is_num && is_digit_(left_ch);
+    }
+
+    for (; right_iter != right_end_iter && right_is_num; ++right_iter)
+    {
+        right_ch = *right_iter;
+        if (right_ch == '.')
+            break;
+        right_is_num = right_is_num && is_digit_(right_ch);
+    }
+
+    if (left_is_num)
+    {
+        if (!right_is_num)
+            return true;
+        return numeric_identifier_is_less_than_(std::string_view(left_part_iter, left_iter),
+                                                std::string_view(right_part_iter, right_iter))
+               || (length_break && left_is_shortest);
+    }
+    if (right_is_num)
+        return false;
+    return left_is_lt;
+}
+
+} // namespace private_
+} // namespace vrsn
+} // namespace arba
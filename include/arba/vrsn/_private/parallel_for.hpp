@@ -0,0 +1,74 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+inline namespace arba
+{
+namespace vrsn
+{
+namespace private_
+{
+
+[[nodiscard]] inline unsigned resolve_thread_count_(unsigned thread_count) noexcept
+{
+    return thread_count != 0 ? thread_count : std::max(1u, std::thread::hardware_concurrency());
+}
+
+// Run task(i) for each i in [0, task_count) on up to `thread_count` threads (0: hardware concurrency), the calling
+// thread included. Threads take the next task from a shared counter, so faster threads take more tasks.
+// The first exception thrown by a task stops the remaining tasks and is rethrown.
+template <class Task>
+void parallel_for_(std::size_t task_count, unsigned thread_count, Task&& task)
+{
+    thread_count = static_cast<unsigned>(std::min<std::size_t>(resolve_thread_count_(thread_count), task_count));
+    if (thread_count <= 1)
+    {
+        for (std::size_t i = 0; i < task_count; ++i)
+            task(i);
+        return;
+    }
+
+    std::atomic<std::size_t> next_task{ 0 };
+    std::exception_ptr exception;
+    std::mutex exception_mutex;
+    const auto worker = [&]
+    {
+        for (;;)
+        {
+            const std::size_t index = next_task.fetch_add(1, std::memory_order_relaxed);
+            if (index >= task_count)
+                return;
+            try
+            {
+                task(index);
+            }
+            catch (...)
+            {
+                std::scoped_lock lock(exception_mutex);
+                if (!exception)
+                    exception = std::current_exception();
+                next_task.store(task_count, std::memory_order_relaxed);
+            }
+        }
+    };
+
+    {
+        std::vector<std::jthread> threads;
+        threads.reserve(thread_count - 1);
+        for (unsigned i = 1; i < thread_count; ++i)
+            threads.emplace_back(worker);
+        worker();
+    }
+    if (exception)
+        std::rethrow_exception(exception);
+}
+
+} // namespace private_
+} // namespace vrsn
+} // namespace arba
@@ -0,0 +1,228 @@
+#pragma once
+
+#include "numver.hpp"
+
+#include <atomic>
+#include <type_traits>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#include <immintrin.h>
+#endif
+
+inline namespace arba
+{
+namespace vrsn
+{
+namespace private_
+{
+
+struct alignas(16) packed_numver_
+{
+    uint64_t major;
+    uint64_t minor_patch; // minor in the high half, patch in the low half
+
+    inline static constexpr packed_numver_ pack(const numver& version) noexcept
+    {
+        return { version.major(), (uint64_t(version.minor()) << 32) | version.patch() };
+    }
+    inline constexpr numver unpack() const noexcept
+    {
+        return numver(major, static_cast<uint32_t>(minor_patch >> 32), static_cast<uint32_t>(minor_patch));
+    }
+};
+
+inline void cpu_relax_() noexcept
+{
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    _mm_pause();
+#endif
+}
+
+// Storage based on a 16-byte compare-and-swap.
+class lock_free_numver_cell_
+{
+public:
+    inline explicit lock_free_numver_cell_(const numver& version) noexcept : value_(packed_numver_::pack(version)) {}
+
+    inline numver load(std::memory_order order) const noexcept { return value_.load(order).unpack(); }
+    inline void store(const numver& version, std::memory_order order) noexcept
+    {
+        value_.store(packed_numver_::pack(version), order);
+    }
+
+    // Replace the value v by next(v) atomically. Return the previous value.
+    template <class NextFunction>
+    inline numver update(NextFunction next) noexcept
+    {
+        packed_numver_ current = value_.load(std::memory_order_relaxed);
+        while (!value_.compare_exchange_weak(current, packed_numver_::pack(next(current.unpack())),
+                                             std::memory_order_acq_rel, std::memory_order_relaxed))
+        {
+        }
+        return current.unpack();
+    }
+
+    inline bool compare_exchange(numver& expected, const numver& desired) noexcept
+    {
+        packed_numver_ packed_expected = packed_numver_::pack(expected);
+        if (value_.compare_exchange_strong(packed_expected, packed_numver_::pack(desired), std::memory_order_acq_rel,
+                                           std::memory_order_acquire))
+            return true;
+        expected = packed_expected.unpack();
+        return false;
+    }
+
+private:
+    std::atomic<packed_numver_> value_;
+};
+
+// Storage based on a sequence lock: readers never block and retry if a write happened meanwhile,
+// writers are serialized by the sequence word (odd while a write is in progress).
+class seqlock_numver_cell_
+{
+public:
+    inline explicit seqlock_numver_cell_(const numver& version) noexcept
+        : major_(version.major()), minor_patch_(packed_numver_::pack(version).minor_patch)
+    {
+    }
+
+    inline numver load(std::memory_order) const noexcept
+    {
+        for (;;)
+        {
+            const uint64_t sequence = sequence_.load(std::memory_order_acquire);
+            if ((sequence & 1) == 0)
+            {
+                const packed_numver_ value{ major_.load(std::memory_order_relaxed),
+                                            minor_patch_.load(std::memory_order_relaxed) };
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (sequence_.load(std::memory_order_relaxed) == sequence)
+                    return value.unpack();
+            }
+            cpu_relax_();
+        }
+    }
+
+    inline void store(const numver& version, std::memory_order) noexcept
+    {
+        update([&](const numver&) { return version; });
+    }
+
+    template <class NextFunction>
+    inline numver update(NextFunction next) noexcept
+    {
+        const uint64_t sequence = lock_();
+        const numver current = packed_numver_{ major_.load(std::memory_order_relaxed),
+                                               minor_patch_.load(std::memory_order_relaxed) }
+                                   .unpack();
+        write_(packed_numver_::pack(next(current)));
+        sequence_.store(sequence + 2, std::memory_order_release);
+        return current;
+    }
+
+    inline bool compare_exchange(numver& expected, const numver& desired) noexcept
+    {
+        const uint64_t sequence = lock_();
+        const numver current = packed_numver_{ major_.load(std::memory_order_relaxed),
+                                               minor_patch_.load(std::memory_order_relaxed) }
+                                   .unpack();
+        const bool is_expected = current == expected;
+        if (is_expected)
+        {
+            write_(packed_numver_::pack(desired));
+            sequence_.store(sequence + 2, std::memory_order_release);
+        }
+        else
+        {
+            sequence_.store(sequence, std::memory_order_release);
+            expected = current;
+        }
+        return is_expected;
+    }
+
+private:
+    // Make the sequence odd. Return its previous (even) value.
+    inline uint64_t lock_() noexcept
+    {
+        uint64_t sequence = sequence_.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            if ((sequence & 1) == 0
+                && sequence_.compare_exchange_weak(sequence, sequence + 1, std::memory_order_acquire,
+                                                   std::memory_order_relaxed))
+                return sequence;
+            cpu_relax_();
+            sequence = sequence_.load(std::memory_order_relaxed);
+        }
+    }
+
+    inline void write_(const packed_numver_& value) noexcept
+    {
+        std::atomic_thread_fence(std::memory_order_release);
+        major_.store(value.major, std::memory_order_relaxed);
+        minor_patch_.store(value.minor_patch, std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<uint64_t> sequence_{ 0 };
+    std::atomic<uint64_t> major_;
+    std::atomic<uint64_t> minor_patch_;
+};
+
+} // namespace private_
+
+// numver shared between threads. fetch_up_major(), fetch_up_minor() and fetch_up_patch() have the same semantics as
+// numver::up_major(), numver::up_minor() and numver::up_patch(), and return the previous version.
+// Operations are lock-free where 16-byte atomics are; otherwise writers are serialized by a sequence lock and loads
+// never block writers.
+class atomic_numver
+{
+public:
+    static constexpr bool is_always_lock_free = std::atomic<private_::packed_numver_>::is_always_lock_free;
+
+    inline atomic_numver() noexcept : cell_(numver()) {}
+    inline explicit atomic_numver(const numver& version) noexcept : cell_(version) {}
+    atomic_numver(const atomic_numver&) = delete;
+    atomic_numver& operator=(const atomic_numver&) = delete;
+
+    inline numver load(std::memory_order order = std::memory_order_seq_cst) const noexcept
+    {
+        return cell_.load(order);
+    }
+    inline void store(const numver& version, std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        cell_.store(version, order);
+    }
+    inline numver exchange(const numver& version) noexcept
+    {
+        return cell_.update([&](const numver&) { return version; });
+    }
+    inline bool compare_exchange(numver& expected, const numver& desired) noexcept
+    {
+        return cell_.compare_exchange(expected, desired);
+    }
+
+    inline numver fetch_up_major() noexcept { return fetch_update_([](numver& version) { version.up_major(); }); }
+    inline numver fetch_up_minor() noexcept { return fetch_update_([](numver& version) { version.up_minor(); }); }
+    inline numver fetch_up_patch() noexcept { return fetch_update_([](numver& version) { version.up_patch(); }); }
+
+    inline operator numver() const noexcept { return load(); }
+
+private:
+    template <class UpFunction>
+    inline numver fetch_update_(UpFunction up) noexcept
+    {
+        return cell_.update(
+            [&](numver version)
+            {
+                up(version);
+                return version;
+            });
+    }
+
+private:
+    std::conditional_t<is_always_lock_free, private_::lock_free_numver_cell_, private_::seqlock_numver_cell_> cell_;
+};
+
+} // namespace vrsn
+} // namespace arba
@@ -0,0 +1,240 @@
+#pragma once
+
+#include "_private/extract_numver.hpp"
+#include "concepts/numver.hpp"
+#include "is_compatible_with.hpp"
+
+#include <arba/vrsn/string/to_chars.hpp>
+#include <algorithm>
+#include <array>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+inline namespace arba
+{
+namespace vrsn
+{
+
+template <std::unsigned_integral Component, std::size_t Size>
+    requires(Size >= 3)
+class basic_numver;
+
+namespace private_
+{
+
+template <std::unsigned_integral Component, std::integral ValueT>
+[[nodiscard]] inline constexpr Component narrow_component_(ValueT value)
+{
+    if (!std::in_range<Component>(value)) [[unlikely]]
+        throw std::out_of_range("A version component does not fit its type.");
+    return static_cast<Component>(value);
+}
+
+// Parse a number made of digits (without leading zero), or return false if it does not fit `Component`.
+template <std::unsigned_integral Component>
+[[nodiscard]] inline constexpr bool parse_component_(std::string_view digits, Component& value) noexcept
+{
+    value = 0;
+    for (char digit : digits)
+    {
+        const Component digit_value = static_cast<Component>(digit - '0');
+        if (value > (std::numeric_limits<Component>::max() - digit_value) / 10)
+            return false;
+        value = static_cast<Component>(value * 10 + digit_value);
+    }
+    return true;
+}
+
+template <class VersionT>
+struct is_basic_numver_ : std::false_type
+{
+};
+
+template <std::unsigned_integral Component, std::size_t Size>
+struct is_basic_numver_<basic_numver<Component, Size>> : std::true_type
+{
+};
+
+} // namespace private_
+
+// Numeric version of `Size` components of type `Component`: basic_numver<uint16_t, 3> ("1.2.3") takes 6 bytes where
+// numver takes 16, and basic_numver<uint32_t, 4> holds four-component versions ("1.2.3.4").
+// The first three components are the major, minor and patch versions: a basic_numver is a Numver, and compares with
+// the compatibility functions like numver. Versions are ordered component by component.
+// Parsing and conversions from other versions are checked: a number which does not fit `Component` is an error.
+template <std::unsigned_integral Component, std::size_t Size>
+    requires(Size >= 3)
+class basic_numver
+{
+public:
+    using component_type = Component;
+
+    static constexpr std::size_t size = Size;
+
+    // 0.1.0 (0.1.0.0 with four components), like numver.
+    constexpr basic_numver() noexcept : components_{ 0, 1 } {}
+
+    template <std::integral... Components>
+        requires(sizeof...(Components) == Size)
+    constexpr explicit basic_numver(Components... components)
+        : components_{ private_::narrow_component_<Component>(components)... }
+    {
+    }
+
+    // The components of `version` missing here must be zero.
+    // Throw std::out_of_range if a component of `version` does not fit.
+    constexpr explicit basic_numver(const Numver auto& version);
+
+    // Throw std::invalid_argument if `version_str` is not made of `Size` numbers separated by dots, and
+    // std::out_of_range if a number does not fit `Component`.
+    constexpr explicit basic_numver(std::string_view version_str);
+
+    [[nodiscard]] inline constexpr Component major() const noexcept { return components_[0]; }
+    [[nodiscard]] inline constexpr Component minor() const noexcept { return components_[1]; }
+    [[nodiscard]] inline constexpr Component patch() const noexcept { return components_[2]; }
+    [[nodiscard]] inline constexpr Component operator[](std::size_t index) const noexcept
+    {
+        return components_[index];
+    }
+    [[nodiscard]] inline constexpr const std::array<Component, Size>& components() const noexcept
+    {
+        return components_;
+    }
+
+    inline constexpr void set_major(Component major) noexcept { components_[0] = major; }
+    inline constexpr void set_minor(Component minor) noexcept { components_[1] = minor; }
+    inline constexpr void set_patch(Component patch) noexcept { components_[2] = patch; }
+    inline constexpr void set(std::size_t index, Component value) noexcept { components_[index] = value; }
+
+    // Increment the component `index` and reset the following ones.
+    inline constexpr void up(std::size_t index) noexcept
+    {
+        ++components_[index];
+        std::fill(components_.begin() + index + 1, components_.end(), Component(0));
+    }
+    inline constexpr void up_major() noexcept { up(0); }
+    inline constexpr void up_minor() noexcept { up(1); }
+    inline constexpr void up_patch() noexcept { up(2); }
+
+    inline constexpr bool is_major_compatible_with(const Numver auto& rv) const noexcept
+    {
+        return vrsn::is_major_compatible_with(*this, rv);
+    }
+    inline constexpr bool is_minor_compatible_with(const Numver auto& rv) const noexcept
+    {
+        return vrsn::is_minor_compatible_with(*this, rv);
+    }
+    inline constexpr bool is_patch_compatible_with(const Numver auto& rv) const noexcept
+    {
+        return vrsn::is_patch_compatible_with(*this, rv);
+    }
+
+    bool operator==(const basic_numver&) const = default;
+    auto operator<=>(const basic_numver&) const = default;
+
+private:
+    std::array<Component, Size> components_;
+};
+
+template <std::unsigned_integral Component, std::size_t Size>
+    requires(Size >= 3)
+constexpr basic_numver<Component, Size>::basic_numver(const Numver auto& version) : components_{}
+{
+    using version_type = std::remove_cvref_t<decltype(version)>;
+    if constexpr (private_::is_basic_numver_<version_type>::value)
+    {
+        for (std::size_t index = 0; index < version_type::size; ++index)
+        {
+            if (index < Size)
+                components_[index] = private_::narrow_component_<Component>(version[index]);
+            else if (version[index] != 0)
+                throw std::out_of_range("A version component does not fit the version.");
+        }
+    }
+    else
+    {
+        components_[0] = private_::narrow_component_<Component>(version.major());
+        components_[1] = private_::narrow_component_<Component>(version.minor());
+        components_[2] = private_::narrow_component_<Component>(version.patch());
+    }
+}
+
+template <std::unsigned_integral Component, std::size_t Size>
+    requires(Size >= 3)
+constexpr basic_numver<Component, Size>::basic_numver(std::string_view version_str) : components_{}
+{
+    auto iter = version_str.cbegin();
+    for (std::size_t index = 0; index < Size; ++index)
+    {
+        if (index > 0)
+            ++iter; // the dot
+        std::string_view digits;
+        const bool is_last = index + 1 == Size;
+        if (!private_::extract_version_number_(iter, version_str.cend(), digits, is_last ? "" : ".", is_last))
+            [[unlikely]]
+            throw std::invalid_argument(std::string(version_str));
+        if (!private_::parse_component_(digits, components_[index])) [[unlikely]]
+            throw std::out_of_range(std::string(version_str));
+    }
+}
+
+// Upper bound of the number of characters written by to_chars() for any basic_numver<Component, Size>.
+template <class Component, std::size_t Size>
+[[nodiscard]] inline constexpr std::size_t max_formatted_size(const basic_numver<Component, Size>&) noexcept
+{
+    return Size * (std::numeric_limits<Component>::digits10 + 1) + Size - 1;
+}
+
+// Write the components separated by dots in [first, last). On failure, return { last, std::errc::value_too_large }.
+template <class Component, std::size_t Size>
+inline constexpr std::to_chars_result to_chars(char* first, char* last,
+                                               const basic_numver<Component, Size>& version) noexcept
+{
+    std::array<std::size_t, Size> digits;
+    std::size_t size = Size - 1;
+    for (std::size_t index = 0; index < Size; ++index)
+    {
+        digits[index] = private_::count_digits_(version[index]);
+        size += digits[index];
+    }
+    if (static_cast<std::size_t>(last - first) < size)
+        return { last, std::errc::value_too_large };
+
+    for (std::size_t index = 0; index < Size; ++index)
+    {
+        if (index > 0)
+            *first++ = '.';
+        first = private_::write_digits_(first, version[index], digits[index]);
+    }
+    return { first, std::errc{} };
+}
+
+} // namespace vrsn
+} // namespace arba
+
+template <class Component, std::size_t Size, class CharT>
+struct std::formatter<::arba::vrsn::basic_numver<Component, Size>, CharT>
+{
+    template <class FormatParseContext>
+    inline constexpr auto parse(FormatParseContext& ctx)
+    {
+        return ctx.begin();
+    }
+
+    template <class FormatContext>
+    auto format(const ::arba::vrsn::basic_numver<Component, Size>& version, FormatContext& ctx) const
+    {
+        char buffer[::arba::vrsn::max_formatted_size(::arba::vrsn::basic_numver<Component, Size>())];
+        const std::to_chars_result res = ::arba::vrsn::to_chars(std::begin(buffer), std::end(buffer), version);
+        return std::copy(std::begin(buffer), res.ptr, ctx.out());
+    }
+};
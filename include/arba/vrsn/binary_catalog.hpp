@@ -0,0 +1,374 @@
+#pragma once
+
+#include "semver_view.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <optional>
+#include <ostream>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+inline namespace arba
+{
+namespace vrsn
+{
+// Binary catalog of package versions, designed to be memory-mapped and read in place.
+//
+// All integers are little-endian. Sections are 8-byte aligned.
+//   header   : magic "VRSNCTLG", u32 format version, u32 reserved, u64 package count, u64 entry count,
+//              u64 packages offset, u64 entries offset, u64 arena offset, u64 arena size.
+//   packages : per package, u64 name offset (in arena), u64 name size, u64 first entry, u64 entry count.
+//              Records are sorted by name.
+//   entries  : per version, u64 major, u32 minor, u32 patch, u64 tail offset (in arena), u32 pre-release size,
+//              u32 build metadata size. The build metadata follows the pre-release in the arena.
+//              Entries of a package are contiguous and sorted by precedence.
+//   arena    : package names, pre-releases and build metadata strings.
+namespace private_
+{
+
+inline constexpr std::array<char, 8> binary_catalog_magic_{ 'V', 'R', 'S', 'N', 'C', 'T', 'L', 'G' };
+inline constexpr uint32_t binary_catalog_format_version_ = 1;
+inline constexpr std::size_t binary_catalog_header_size_ = 64;
+inline constexpr std::size_t binary_catalog_package_size_ = 32;
+inline constexpr std::size_t binary_catalog_entry_size_ = 32;
+
+template <class UIntT>
+inline void store_le_(std::byte* dest, UIntT value) noexcept
+{
+    for (std::size_t i = 0; i < sizeof(UIntT); ++i)
+        dest[i] = static_cast<std::byte>((value >> (8 * i)) & 0xFF);
+}
+
+template <class UIntT>
+[[nodiscard]] inline UIntT load_le_(const std::byte* src) noexcept
+{
+    UIntT value = 0;
+    for (std::size_t i = 0; i < sizeof(UIntT); ++i)
+        value |= static_cast<UIntT>(std::to_integer<UIntT>(src[i]) << (8 * i));
+    return value;
+}
+
+[[nodiscard]] inline constexpr uint64_t align8_(uint64_t offset) noexcept
+{
+    return (offset + 7) & ~uint64_t(7);
+}
+
+// Entries and string arena of a binary catalog, referring to its bytes: what is needed to decode versions.
+// Package views and their iterators hold a copy, so that they do not depend on the catalog view they come from.
+struct binary_catalog_sections_
+{
+    const std::byte* entries = nullptr;
+    std::size_t entry_count = 0;
+    const char* arena = nullptr;
+    uint64_t arena_size = 0;
+
+    [[nodiscard]] std::string_view arena_string(uint64_t offset, uint64_t size) const;
+    [[nodiscard]] semver_view entry(std::size_t index) const;
+};
+
+} // namespace private_
+
+class binary_catalog_writer
+{
+public:
+    void add(std::string_view package, const semver& version);
+    inline std::size_t package_count() const noexcept { return packages_.size(); }
+
+    // Serialize the catalog. Throws std::runtime_error if the output cannot be written.
+    void write(std::ostream& stream) const;
+    void write(const std::filesystem::path& path) const;
+    [[nodiscard]] std::vector<std::byte> to_bytes() const;
+
+private:
+    std::map<std::string, std::vector<semver>, std::less<>> packages_;
+};
+
+// Zero-copy reader over the bytes of a binary catalog (e.g. mapped_file::bytes()).
+// Opening only checks the header and the section bounds: its cost does not depend on the catalog size.
+class binary_catalog_view
+{
+public:
+    class package_view;
+
+    binary_catalog_view() = default;
+    explicit binary_catalog_view(std::span<const std::byte> bytes);
+
+    inline std::size_t package_count() const noexcept { return package_count_; }
+    inline std::size_t entry_count() const noexcept { return sections_.entry_count; }
+
+    [[nodiscard]] package_view package(std::size_t index) const;
+    [[nodiscard]] std::optional<package_view> find(std::string_view package_name) const;
+
+private:
+    [[nodiscard]] std::string_view package_name_(std::size_t index) const;
+
+private:
+    std::span<const std::byte> bytes_;
+    std::size_t package_count_ = 0;
+    const std::byte* packages_ = nullptr;
+    private_::binary_catalog_sections_ sections_;
+};
+
+// Versions of a package. A package view and its iterators refer to the bytes of the catalog, not to the
+// binary_catalog_view they come from: they stay valid as long as the bytes.
+class binary_catalog_view::package_view
+{
+public:
+    // The versions are decoded on dereference and returned by value: a forward iterator for the C++20 concepts, but
+    // only an input iterator for the legacy requirements.
+    class iterator
+    {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using iterator_concept = std::forward_iterator_tag;
+        using value_type = semver_view;
+        using difference_type = std::ptrdiff_t;
+
+        iterator() = default;
+        inline semver_view operator*() const { return sections_.entry(index_); }
+        inline iterator& operator++() noexcept
+        {
+            ++index_;
+            return *this;
+        }
+        inline iterator operator++(int) noexcept
+        {
+            iterator res = *this;
+            ++index_;
+            return res;
+        }
+        inline bool operator==(const iterator& other) const noexcept { return index_ == other.index_; }
+
+    private:
+        friend class package_view;
+        inline iterator(const private_::binary_catalog_sections_& sections, std::size_t index) noexcept
+            : sections_(sections), index_(index)
+        {
+        }
+
+        private_::binary_catalog_sections_ sections_;
+        std::size_t index_ = 0;
+    };
+
+    inline std::string_view name() const noexcept { return name_; }
+    inline std::size_t size() const noexcept { return size_; }
+    inline bool empty() const noexcept { return size_ == 0; }
+    inline semver_view operator[](std::size_t index) const { return sections_.entry(first_entry_ + index); }
+    inline semver_view back() const { return operator[](size_ - 1); }
+    inline iterator begin() const noexcept { return iterator(sections_, first_entry_); }
+    inline iterator end() const noexcept { return iterator(sections_, first_entry_ + size_); }
+
+private:
+    friend class binary_catalog_view;
+    inline package_view(const private_::binary_catalog_sections_& sections, std::string_view name,
+                        std::size_t first_entry, std::size_t size) noexcept
+        : sections_(sections), name_(name), first_entry_(first_entry), size_(size)
+    {
+    }
+
+    private_::binary_catalog_sections_ sections_;
+    std::string_view name_;
+    std::size_t first_entry_;
+    std::size_t size_;
+};
+
+static_assert(std::forward_iterator<binary_catalog_view::package_view::iterator>);
+
+// binary_catalog_writer
+
+inline void binary_catalog_writer::add(std::string_view package, const semver& version)
+{
+    auto iter = packages_.find(package);
+    if (iter == packages_.end())
+        iter = packages_.emplace(std::string(package), std::vector<semver>()).first;
+    iter->second.push_back(version);
+}
+
+inline std::vector<std::byte> binary_catalog_writer::to_bytes() const
+{
+    using namespace private_;
+
+    std::string arena;
+    std::unordered_map<std::string, uint64_t> tail_offsets;
+    std::vector<std::byte> packages(packages_.size() * binary_catalog_package_size_);
+    std::vector<std::byte> entries;
+    uint64_t entry_count = 0;
+
+    std::byte* package_record = packages.data();
+    for (const auto& [name, unsorted_versions] : packages_)
+    {
+        std::vector<semver> versions = unsorted_versions;
+        std::stable_sort(versions.begin(), versions.end());
+
+        store_le_<uint64_t>(package_record, arena.size());
+        store_le_<uint64_t>(package_record + 8, name.size());
+        store_le_<uint64_t>(package_record + 16, entry_count);
+        store_le_<uint64_t>(package_record + 24, versions.size());
+        package_record += binary_catalog_package_size_;
+        arena += name;
+
+        entries.resize(entries.size() + versions.size() * binary_catalog_entry_size_);
+        std::byte* entry_record = entries.data() + entry_count * binary_catalog_entry_size_;
+        for (const semver& version : versions)
+        {
+            std::string tail;
+            tail.reserve(version.pre_release().size() + version.build_metadata().size());
+            tail += version.pre_release();
+            tail += version.build_metadata();
+            auto [tail_iter, inserted] = tail_offsets.try_emplace(tail, arena.size());
+            if (inserted)
+                arena += tail;
+
+            store_le_<uint64_t>(entry_record, version.major());
+            store_le_<uint32_t>(entry_record + 8, version.minor());
+            store_le_<uint32_t>(entry_record + 12, version.patch());
+            store_le_<uint64_t>(entry_record + 16, tail_iter->second);
+            store_le_<uint32_t>(entry_record + 24, static_cast<uint32_t>(version.pre_release().size()));
+            store_le_<uint32_t>(entry_record + 28, static_cast<uint32_t>(version.build_metadata().size()));
+            entry_record += binary_catalog_entry_size_;
+        }
+        entry_count += versions.size();
+    }
+
+    const uint64_t packages_offset = binary_catalog_header_size_;
+    const uint64_t entries_offset = align8_(packages_offset + packages.size());
+    const uint64_t arena_offset = align8_(entries_offset + entries.size());
+
+    std::vector<std::byte> bytes(arena_offset + arena.size());
+    std::byte* header = bytes.data();
+    std::memcpy(header, binary_catalog_magic_.data(), binary_catalog_magic_.size());
+    store_le_<uint32_t>(header + 8, binary_catalog_format_version_);
+    store_le_<uint32_t>(header + 12, 0);
+    store_le_<uint64_t>(header + 16, packages_.size());
+    store_le_<uint64_t>(header + 24, entry_count);
+    store_le_<uint64_t>(header + 32, packages_offset);
+    store_le_<uint64_t>(header + 40, entries_offset);
+    store_le_<uint64_t>(header + 48, arena_offset);
+    store_le_<uint64_t>(header + 56, arena.size());
+    std::copy(packages.begin(), packages.end(), bytes.begin() + packages_offset);
+    std::copy(entries.begin(), entries.end(), bytes.begin() + entries_offset);
+    std::memcpy(bytes.data() + arena_offset, arena.data(), arena.size());
+    return bytes;
+}
+
+inline void binary_catalog_writer::write(std::ostream& stream) const
+{
+    const std::vector<std::byte> bytes = to_bytes();
+    stream.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    if (!stream)
+        throw std::runtime_error("Failed to write the binary catalog.");
+}
+
+inline void binary_catalog_writer::write(const std::filesystem::path& path) const
+{
+    std::ofstream stream(path, std::ios::binary | std::ios::trunc);
+    if (!stream)
+        throw std::runtime_error("Failed to open '" + path.string() + "'.");
+    write(stream);
+}
+
+// binary_catalog_sections_
+
+inline std::string_view private_::binary_catalog_sections_::arena_string(uint64_t offset, uint64_t size) const
+{
+    if (offset > arena_size || size > arena_size - offset) [[unlikely]]
+        throw std::out_of_range("Binary catalog string is out of bounds.");
+    return std::string_view(arena + offset, size);
+}
+
+inline semver_view private_::binary_catalog_sections_::entry(std::size_t index) const
+{
+    if (index >= entry_count) [[unlikely]]
+        throw std::out_of_range("Binary catalog entry index is out of range.");
+    const std::byte* record = entries + index * binary_catalog_entry_size_;
+    const uint32_t pre_release_size = load_le_<uint32_t>(record + 24);
+    const uint32_t build_metadata_size = load_le_<uint32_t>(record + 28);
+    const std::string_view tail =
+        arena_string(load_le_<uint64_t>(record + 16), uint64_t(pre_release_size) + build_metadata_size);
+    return semver_view(numver(load_le_<uint64_t>(record), load_le_<uint32_t>(record + 8),
+                              load_le_<uint32_t>(record + 12)),
+                       tail.substr(0, pre_release_size), tail.substr(pre_release_size));
+}
+
+// binary_catalog_view
+
+inline binary_catalog_view::binary_catalog_view(std::span<const std::byte> bytes) : bytes_(bytes)
+{
+    using namespace private_;
+
+    if (bytes.size() < binary_catalog_header_size_
+        || std::memcmp(bytes.data(), binary_catalog_magic_.data(), binary_catalog_magic_.size()) != 0)
+        throw std::invalid_argument("Input is not a binary catalog.");
+    if (load_le_<uint32_t>(bytes.data() + 8) != binary_catalog_format_version_)
+        throw std::invalid_argument("Unsupported binary catalog format version.");
+
+    const uint64_t package_count = load_le_<uint64_t>(bytes.data() + 16);
+    const uint64_t entry_count = load_le_<uint64_t>(bytes.data() + 24);
+    const uint64_t packages_offset = load_le_<uint64_t>(bytes.data() + 32);
+    const uint64_t entries_offset = load_le_<uint64_t>(bytes.data() + 40);
+    const uint64_t arena_offset = load_le_<uint64_t>(bytes.data() + 48);
+    const uint64_t arena_size = load_le_<uint64_t>(bytes.data() + 56);
+
+    const auto section_fits = [&](uint64_t offset, uint64_t count, uint64_t record_size)
+    { return offset <= bytes.size() && count <= (bytes.size() - offset) / record_size; };
+    if (!section_fits(packages_offset, package_count, binary_catalog_package_size_)
+        || !section_fits(entries_offset, entry_count, binary_catalog_entry_size_)
+        || !section_fits(arena_offset, arena_size, 1))
+        throw std::invalid_argument("Binary catalog sections are out of bounds.");
+
+    package_count_ = package_count;
+    packages_ = bytes.data() + packages_offset;
+    sections_ = { bytes.data() + entries_offset, static_cast<std::size_t>(entry_count),
+                  reinterpret_cast<const char*>(bytes.data() + arena_offset), arena_size };
+}
+
+inline std::string_view binary_catalog_view::package_name_(std::size_t index) const
+{
+    const std::byte* record = packages_ + index * private_::binary_catalog_package_size_;
+    return sections_.arena_string(private_::load_le_<uint64_t>(record), private_::load_le_<uint64_t>(record + 8));
+}
+
+inline binary_catalog_view::package_view binary_catalog_view::package(std::size_t index) const
+{
+    if (index >= package_count_) [[unlikely]]
+        throw std::out_of_range("Binary catalog package index is out of range.");
+    const std::byte* record = packages_ + index * private_::binary_catalog_package_size_;
+    const uint64_t first_entry = private_::load_le_<uint64_t>(record + 16);
+    const uint64_t size = private_::load_le_<uint64_t>(record + 24);
+    if (first_entry > sections_.entry_count || size > sections_.entry_count - first_entry) [[unlikely]]
+        throw std::out_of_range("Binary catalog package entries are out of bounds.");
+    return package_view(sections_, package_name_(index), first_entry, size);
+}
+
+inline std::optional<binary_catalog_view::package_view> binary_catalog_view::find(std::string_view package_name) const
+{
+    std::size_t first = 0;
+    std::size_t count = package_count_;
+    while (count > 0)
+    {
+        const std::size_t step = count / 2;
+        if (package_name_(first + step) < package_name)
+        {
+            first += step + 1;
+            count -= step + 1;
+        }
+        else
+            count = step;
+    }
+    if (first < package_count_ && package_name_(first) == package_name)
+        return package(first);
+    return std::nullopt;
+}
+
+} // namespace vrsn
+} // namespace arba
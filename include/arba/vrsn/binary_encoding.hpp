@@ -0,0 +1,259 @@
+#pragma once
+
+#include "semver_view.hpp"
+
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <system_error>
+
+inline namespace arba
+{
+namespace vrsn
+{
+// Compact binary encoding of versions.
+//
+// The first byte is a header:
+//   0b0MMmmppp : short form, major in [0, 3], minor in [0, 3], patch in [0, 7], no pre-release, no build metadata.
+//   0b100000PB : long form, followed by major, minor and patch as unsigned LEB128 varints, then (if P is set) the
+//                pre-release and (if B is set) the build metadata, each as a varint length followed by its bytes.
+// A numver is always encoded without pre-release and build metadata.
+
+struct binary_result
+{
+    std::size_t size; // number of bytes written or read
+    std::errc ec;
+
+    inline constexpr explicit operator bool() const noexcept { return ec == std::errc{}; }
+};
+
+inline constexpr std::size_t max_encoded_numver_size = 1 + 10 + 5 + 5;
+
+namespace private_
+{
+
+inline constexpr std::byte binary_long_form_ = std::byte(0x80);
+inline constexpr std::byte binary_has_pre_release_ = std::byte(0x02);
+inline constexpr std::byte binary_has_build_metadata_ = std::byte(0x01);
+
+[[nodiscard]] inline constexpr bool has_short_binary_form_(const numver& version) noexcept
+{
+    return version.major() < 4 && version.minor() < 4 && version.patch() < 8;
+}
+
+[[nodiscard]] inline constexpr std::size_t varint_size_(uint64_t value) noexcept
+{
+    std::size_t size = 1;
+    for (; value >= 0x80; value >>= 7)
+        ++size;
+    return size;
+}
+
+inline constexpr std::byte* write_varint_(std::byte* iter, uint64_t value) noexcept
+{
+    for (; value >= 0x80; value >>= 7)
+        *iter++ = std::byte((value & 0x7F) | 0x80);
+    *iter++ = std::byte(value);
+    return iter;
+}
+
+[[nodiscard]] inline constexpr bool read_varint_(std::span<const std::byte> input, std::size_t& pos,
+                                                 uint64_t& value) noexcept
+{
+    value = 0;
+    for (unsigned shift = 0; shift < 64; shift += 7)
+    {
+        if (pos == input.size())
+            return false;
+        const uint64_t byte = std::to_integer<uint64_t>(input[pos++]);
+        if (shift == 63 && byte > 1)
+            return false;
+        value |= (byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0)
+            return true;
+    }
+    return false;
+}
+
+[[nodiscard]] inline constexpr std::size_t encoded_size_(const numver& core, std::string_view pre_release,
+                                                         std::string_view build_metadata) noexcept
+{
+    if (pre_release.empty() && build_metadata.empty() && has_short_binary_form_(core))
+        return 1;
+    std::size_t size = 1 + varint_size_(core.major()) + varint_size_(core.minor()) + varint_size_(core.patch());
+    if (!pre_release.empty())
+        size += varint_size_(pre_release.size()) + pre_release.size();
+    if (!build_metadata.empty())
+        size += varint_size_(build_metadata.size()) + build_metadata.size();
+    return size;
+}
+
+inline constexpr binary_result encode_to_(std::span<std::byte> output, const numver& core,
+                                          std::string_view pre_release, std::string_view build_metadata) noexcept
+{
+    const std::size_t size = encoded_size_(core, pre_release, build_metadata);
+    if (size > output.size())
+        return { 0, std::errc::value_too_large };
+
+    std::byte* iter = output.data();
+    if (size == 1)
+    {
+        *iter = std::byte((core.major() << 5) | (core.minor() << 3) | core.patch());
+        return { 1, std::errc{} };
+    }
+
+    std::byte header = binary_long_form_;
+    if (!pre_release.empty())
+        header |= binary_has_pre_release_;
+    if (!build_metadata.empty())
+        header |= binary_has_build_metadata_;
+    *iter++ = header;
+    iter = write_varint_(iter, core.major());
+    iter = write_varint_(iter, core.minor());
+    iter = write_varint_(iter, core.patch());
+    for (std::string_view str : { pre_release, build_metadata })
+    {
+        if (str.empty())
+            continue;
+        iter = write_varint_(iter, str.size());
+        for (char ch : str)
+            *iter++ = std::byte(ch);
+    }
+    return { size, std::errc{} };
+}
+
+[[nodiscard]] inline constexpr binary_result decode_core_(std::span<const std::byte> input, numver& core,
+                                                          std::byte& header) noexcept
+{
+    if (input.empty())
+        return { 0, std::errc::invalid_argument };
+
+    header = input[0];
+    if ((header & binary_long_form_) == std::byte{ 0 })
+    {
+        const unsigned bits = std::to_integer<unsigned>(header);
+        core = numver(bits >> 5, (bits >> 3) & 0x3, bits & 0x7);
+        return { 1, std::errc{} };
+    }
+    if ((header & ~(binary_long_form_ | binary_has_pre_release_ | binary_has_build_metadata_)) != std::byte{ 0 })
+        return { 0, std::errc::invalid_argument };
+
+    std::size_t pos = 1;
+    uint64_t major = 0, minor = 0, patch = 0;
+    if (!read_varint_(input, pos, major) || !read_varint_(input, pos, minor) || !read_varint_(input, pos, patch))
+        return { 0, std::errc::invalid_argument };
+    if (minor > std::numeric_limits<uint32_t>::max() || patch > std::numeric_limits<uint32_t>::max())
+        return { 0, std::errc::result_out_of_range };
+    core = numver(major, static_cast<uint32_t>(minor), static_cast<uint32_t>(patch));
+    return { pos, std::errc{} };
+}
+
+[[nodiscard]] inline constexpr bool read_binary_string_(std::span<const std::byte> input, std::size_t& pos,
+                                                        std::string_view& str) noexcept
+{
+    uint64_t size = 0;
+    if (!read_varint_(input, pos, size) || size == 0 || size > input.size() - pos)
+        return false;
+    str = std::string_view(reinterpret_cast<const char*>(input.data() + pos), size);
+    pos += size;
+    return true;
+}
+
+} // namespace private_
+
+[[nodiscard]] inline constexpr std::size_t encoded_size(const numver& version) noexcept
+{
+    return private_::encoded_size_(version, std::string_view(), std::string_view());
+}
+
+[[nodiscard]] inline constexpr std::size_t encoded_size(const semver_view& version) noexcept
+{
+    return private_::encoded_size_(version.core(), version.pre_release(), version.build_metadata());
+}
+
+[[nodiscard]] inline constexpr std::size_t encoded_size(const semver& version) noexcept
+{
+    return encoded_size(semver_view(version));
+}
+
+// Write `version` at the beginning of `output`. On failure (std::errc::value_too_large), nothing is written.
+inline constexpr binary_result encode_to(std::span<std::byte> output, const numver& version) noexcept
+{
+    return private_::encode_to_(output, version, std::string_view(), std::string_view());
+}
+
+inline constexpr binary_result encode_to(std::span<std::byte> output, const semver_view& version) noexcept
+{
+    return private_::encode_to_(output, version.core(), version.pre_release(), version.build_metadata());
+}
+
+inline constexpr binary_result encode_to(std::span<std::byte> output, const semver& version) noexcept
+{
+    return encode_to(output, semver_view(version));
+}
+
+// Read a version from the beginning of `input`.
+// Errors: std::errc::invalid_argument if the input is truncated or malformed (or, for a numver, if it holds a
+// pre-release or build metadata), std::errc::result_out_of_range if a number does not fit the version core.
+inline constexpr binary_result decode_from(std::span<const std::byte> input, numver& version) noexcept
+{
+    std::byte header{};
+    const binary_result res = private_::decode_core_(input, version, header);
+    if (res && res.size > 1
+        && (header & (private_::binary_has_pre_release_ | private_::binary_has_build_metadata_)) != std::byte{ 0 })
+        return { 0, std::errc::invalid_argument };
+    return res;
+}
+
+// The pre-release and build metadata of the decoded view refer to `input`.
+inline constexpr binary_result decode_from(std::span<const std::byte> input, semver_view& version) noexcept
+{
+    std::byte header{};
+    numver core;
+    binary_result res = private_::decode_core_(input, core, header);
+    if (!res)
+        return res;
+
+    std::size_t pos = res.size;
+    std::string_view pre_release, build_metadata;
+    if (pos == 1)
+    {
+        version = semver_view(core);
+        return res;
+    }
+    if ((header & private_::binary_has_pre_release_) != std::byte{ 0 })
+    {
+        std::string_view checked_pre_release;
+        if (!private_::read_binary_string_(input, pos, pre_release)
+            || !private_::extract_pre_release_(pre_release, checked_pre_release)
+            || checked_pre_release.size() != pre_release.size())
+            return { 0, std::errc::invalid_argument };
+    }
+    if ((header & private_::binary_has_build_metadata_) != std::byte{ 0 })
+    {
+        if (!private_::read_binary_string_(input, pos, build_metadata)
+            || !private_::check_build_metadata_(build_metadata))
+            return { 0, std::errc::invalid_argument };
+    }
+    version = semver_view(core, pre_release, build_metadata);
+    return { pos, std::errc{} };
+}
+
+// The pre-release and build metadata are assigned to the strings of `version`, whose storage is reused: decoding
+// repeatedly into the same semver stops allocating once its strings are large enough. Decoding into a semver_view
+// never allocates. On failure, `version` is left unchanged.
+inline binary_result decode_from(std::span<const std::byte> input, semver& version)
+{
+    semver_view view;
+    const binary_result res = decode_from(input, view);
+    if (res)
+    {
+        version.core() = view.core();
+        version.set_pre_release(view.pre_release());
+        version.set_build_metadata(view.build_metadata());
+    }
+    return res;
+}
+
+} // namespace vrsn
+} // namespace arba
@@ -0,0 +1,333 @@
+#pragma once
+
+#include "binary_encoding.hpp"
+#include "semver_view.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+inline namespace arba
+{
+namespace vrsn
+{
+
+// Read-only sorted set of versions stored in compressed form.
+//
+// Each version core is delta-encoded against the previous one:
+//   header byte: 0bDDDDDTKK, KK being the kind of change, T set if the version has a tail (pre-release and/or build
+//                metadata), DDDDD the delta if it is less than 31 (else 31, and the delta minus 31 follows as a
+//                varint);
+//   KK = 0: same major and minor, patch += delta;
+//   KK = 1: same major, minor += delta, followed by the patch as a varint;
+//   KK = 2: major += delta, followed by the minor and the patch as varints;
+//   then, if T is set, the index of the tail as a varint.
+// A regular patch bump thus costs one byte. Tails are deduplicated in a side table. The core of every block_size-th
+// version is stored in full, so that a version is decoded from the start of its block, without decompressing the set.
+// Elements are returned as semver_view referring to the set.
+class compact_version_set
+{
+public:
+    static constexpr std::size_t block_size = 64;
+
+    class iterator;
+
+    compact_version_set() = default;
+    // Versions of equal precedence are stored once (the first one after a stable sort).
+    explicit compact_version_set(std::vector<semver> versions);
+
+    [[nodiscard]] inline std::size_t size() const noexcept { return size_; }
+    [[nodiscard]] inline bool empty() const noexcept { return size_ == 0; }
+    [[nodiscard]] semver_view operator[](std::size_t index) const;
+
+    [[nodiscard]] iterator begin() const;
+    [[nodiscard]] iterator end() const;
+
+    // Index of the first version not less than `version` (size() if there is none).
+    [[nodiscard]] std::size_t lower_bound(const semver_view& version) const;
+    [[nodiscard]] inline bool contains(const semver_view& version) const
+    {
+        const std::size_t index = lower_bound(version);
+        return index != size_ && (*this)[index] == version;
+    }
+
+    // Number of bytes allocated by the set.
+    [[nodiscard]] std::size_t memory_usage() const noexcept;
+
+private:
+    enum : uint8_t
+    {
+        same_minor_ = 0,
+        new_minor_ = 1,
+        new_major_ = 2,
+        has_tail_ = 0x04,
+        inline_delta_limit_ = 31
+    };
+
+    struct tail_
+    {
+        uint32_t pre_release_offset;
+        uint32_t pre_release_size;
+        uint32_t build_metadata_offset;
+        uint32_t build_metadata_size;
+    };
+
+    void encode_(const semver& previous, const semver& version, std::size_t tail_index);
+    // Decode the version at `pos`, `core` being the core of the previous version (or of the block). Advance `pos`.
+    semver_view decode_(std::size_t& pos, numver& core) const;
+    uint64_t next_varint_(std::size_t& pos) const noexcept;
+    inline semver_view block_front_(std::size_t block) const
+    {
+        std::size_t pos = block_offsets_[block];
+        numver core = block_cores_[block];
+        return decode_(pos, core);
+    }
+
+private:
+    std::size_t size_ = 0;
+    std::vector<std::byte> data_;
+    std::vector<numver> block_cores_;
+    std::vector<std::size_t> block_offsets_;
+    std::vector<tail_> tails_;
+    std::string tail_chars_;
+};
+
+// The versions are decoded into the iterator and returned by value: it is a forward iterator for the C++20 concepts,
+// but only an input iterator for the legacy requirements, which want a reference to a stored version.
+class compact_version_set::iterator
+{
+public:
+    using iterator_category = std::input_iterator_tag;
+    using iterator_concept = std::forward_iterator_tag;
+    using value_type = semver_view;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const semver_view*;
+    using reference = semver_view;
+
+    iterator() = default;
+
+    inline reference operator*() const noexcept { return version_; }
+    inline pointer operator->() const noexcept { return &version_; }
+    inline iterator& operator++()
+    {
+        ++index_;
+        load_();
+        return *this;
+    }
+    inline iterator operator++(int)
+    {
+        iterator previous = *this;
+        ++*this;
+        return previous;
+    }
+    inline bool operator==(const iterator& other) const noexcept { return index_ == other.index_; }
+
+private:
+    friend class compact_version_set;
+    // `index` is 0 or the size of the set.
+    inline iterator(const compact_version_set* set, std::size_t index) : set_(set), index_(index) { load_(); }
+
+    inline void load_()
+    {
+        if (index_ >= set_->size_)
+            return;
+        if (index_ % block_size == 0)
+        {
+            core_ = set_->block_cores_[index_ / block_size];
+            pos_ = set_->block_offsets_[index_ / block_size];
+        }
+        version_ = set_->decode_(pos_, core_);
+    }
+
+    const compact_version_set* set_ = nullptr;
+    std::size_t index_ = 0;
+    std::size_t pos_ = 0;
+    numver core_;
+    semver_view version_;
+};
+
+static_assert(std::forward_iterator<compact_version_set::iterator>);
+
+inline compact_version_set::compact_version_set(std::vector<semver> versions)
+{
+    std::stable_sort(versions.begin(), versions.end());
+    versions.erase(std::unique(versions.begin(), versions.end()), versions.end());
+    size_ = versions.size();
+
+    std::unordered_map<std::string, std::size_t> tail_indices;
+    for (std::size_t index = 0; index < versions.size(); ++index)
+    {
+        const semver& version = versions[index];
+        std::size_t tail_index = 0;
+        if (!version.pre_release().empty() || !version.build_metadata().empty())
+        {
+            // The pre-release cannot contain '+': it separates the two parts of the key.
+            std::string key = std::string(version.pre_release()) + '+' + std::string(version.build_metadata());
+            auto [iter, inserted] = tail_indices.try_emplace(std::move(key), tails_.size());
+            if (inserted)
+            {
+                tail_ tail;
+                tail.pre_release_offset = static_cast<uint32_t>(tail_chars_.size());
+                tail.pre_release_size = static_cast<uint32_t>(version.pre_release().size());
+                tail_chars_ += version.pre_release();
+                tail.build_metadata_offset = static_cast<uint32_t>(tail_chars_.size());
+                tail.build_metadata_size = static_cast<uint32_t>(version.build_metadata().size());
+                tail_chars_ += version.build_metadata();
+                tails_.push_back(tail);
+            }
+            tail_index = iter->second;
+        }
+
+        if (index % block_size == 0)
+        {
+            block_cores_.push_back(version.core());
+            block_offsets_.push_back(data_.size());
+            encode_(version, version, tail_index);
+        }
+        else
+            encode_(versions[index - 1], version, tail_index);
+    }
+    data_.shrink_to_fit();
+    tails_.shrink_to_fit();
+    tail_chars_.shrink_to_fit();
+}
+
+inline void compact_version_set::encode_(const semver& previous, const semver& version, std::size_t tail_index)
+{
+    uint8_t kind;
+    uint64_t delta;
+    if (version.major() != previous.major())
+    {
+        kind = new_major_;
+        delta = version.major() - previous.major();
+    }
+    else if (version.minor() != previous.minor())
+    {
+        kind = new_minor_;
+        delta = version.minor() - previous.minor();
+    }
+    else
+    {
+        kind = same_minor_;
+        delta = version.patch() - previous.patch();
+    }
+    const bool has_tail = !version.pre_release().empty() || !version.build_metadata().empty();
+
+    std::byte buffer[1 + 4 * 10]; // 10: maximal size of a 64-bit varint
+    std::byte* iter = buffer;
+    *iter++ = std::byte((std::min<uint64_t>(delta, inline_delta_limit_) << 3) | (has_tail ? has_tail_ : 0) | kind);
+    if (delta >= inline_delta_limit_)
+        iter = private_::write_varint_(iter, delta - inline_delta_limit_);
+    if (kind == new_major_)
+        iter = private_::write_varint_(iter, version.minor());
+    if (kind != same_minor_)
+        iter = private_::write_varint_(iter, version.patch());
+    if (has_tail)
+        iter = private_::write_varint_(iter, tail_index);
+    data_.insert(data_.end(), buffer, iter);
+}
+
+inline uint64_t compact_version_set::next_varint_(std::size_t& pos) const noexcept
+{
+    uint64_t value = 0;
+    [[maybe_unused]] const bool is_valid = private_::read_varint_(data_, pos, value);
+    return value;
+}
+
+inline semver_view compact_version_set::decode_(std::size_t& pos, numver& core) const
+{
+    const uint8_t header = std::to_integer<uint8_t>(data_[pos++]);
+    uint64_t delta = header >> 3;
+    if (delta == inline_delta_limit_)
+        delta += next_varint_(pos);
+    switch (header & 0x03)
+    {
+    case same_minor_:
+        core = numver(core.major(), core.minor(), static_cast<uint32_t>(core.patch() + delta));
+        break;
+    case new_minor_:
+    {
+        const uint32_t patch = static_cast<uint32_t>(next_varint_(pos));
+        core = numver(core.major(), static_cast<uint32_t>(core.minor() + delta), patch);
+        break;
+    }
+    default:
+    {
+        const uint32_t minor = static_cast<uint32_t>(next_varint_(pos));
+        const uint32_t patch = static_cast<uint32_t>(next_varint_(pos));
+        core = numver(core.major() + delta, minor, patch);
+        break;
+    }
+    }
+    if ((header & has_tail_) == 0)
+        return semver_view(core);
+    const tail_& tail = tails_[next_varint_(pos)];
+    const std::string_view chars = tail_chars_;
+    return semver_view(core, chars.substr(tail.pre_release_offset, tail.pre_release_size),
+                       chars.substr(tail.build_metadata_offset, tail.build_metadata_size));
+}
+
+inline semver_view compact_version_set::operator[](std::size_t index) const
+{
+    const std::size_t block = index / block_size;
+    std::size_t pos = block_offsets_[block];
+    numver core = block_cores_[block];
+    semver_view version = decode_(pos, core);
+    for (std::size_t i = block * block_size; i < index; ++i)
+        version = decode_(pos, core);
+    return version;
+}
+
+inline compact_version_set::iterator compact_version_set::begin() const
+{
+    return iterator(this, 0);
+}
+
+inline compact_version_set::iterator compact_version_set::end() const
+{
+    return iterator(this, size_);
+}
+
+inline std::size_t compact_version_set::lower_bound(const semver_view& version) const
+{
+    // First block whose first version is not less than `version`: the answer is in the previous block, or is the
+    // first version of this block.
+    std::size_t block = 0;
+    for (std::size_t count = block_offsets_.size(); count > 0;)
+    {
+        const std::size_t half = count / 2;
+        if (block_front_(block + half) < version)
+        {
+            block += half + 1;
+            count -= half + 1;
+        }
+        else
+            count = half;
+    }
+    if (block == 0)
+        return 0;
+
+    std::size_t pos = block_offsets_[block - 1];
+    numver core = block_cores_[block - 1];
+    const std::size_t last = std::min(block * block_size, size_);
+    for (std::size_t index = (block - 1) * block_size; index < last; ++index)
+    {
+        if (!(decode_(pos, core) < version))
+            return index;
+    }
+    return last;
+}
+
+inline std::size_t compact_version_set::memory_usage() const noexcept
+{
+    return data_.capacity() * sizeof(std::byte) + block_cores_.capacity() * sizeof(numver)
+           + block_offsets_.capacity() * sizeof(std::size_t) + tails_.capacity() * sizeof(tail_)
+           + tail_chars_.capacity();
+}
+
+} // namespace vrsn
+} // namespace arba
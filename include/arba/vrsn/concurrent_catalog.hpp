@@ -0,0 +1,337 @@
+#pragma once
+
+#include "is_compatible_with.hpp"
+#include "semver.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+inline namespace arba
+{
+namespace vrsn
+{
+
+// Catalog (package name -> sorted versions) read concurrently by many threads while being updated.
+//
+// Packages are spread over a fixed number of buckets. A writer never modifies a published bucket: it builds a new one
+// and publishes it atomically (read-copy-update). Reading threads access the catalog through a reader, which announces
+// the epoch it reads in, so that a replaced bucket is only freed once no reader may still use it (epoch-based
+// reclamation). Reads are wait-free; writes are serialized.
+template <class VersionT = semver>
+class concurrent_catalog
+{
+private:
+    struct package_
+    {
+        std::string name;
+        std::vector<VersionT> versions; // sorted
+    };
+
+    struct bucket_
+    {
+        std::vector<std::shared_ptr<const package_>> packages;
+    };
+
+    struct retired_bucket_
+    {
+        const bucket_* bucket;
+        uint64_t epoch;
+    };
+
+    struct alignas(64) reader_slot_
+    {
+        std::atomic<uint64_t> epoch{ idle_epoch_ };
+        bool in_use = false;
+    };
+
+    static constexpr uint64_t idle_epoch_ = std::numeric_limits<uint64_t>::max();
+
+public:
+    class reader;
+
+    explicit concurrent_catalog(std::size_t bucket_count = 1024);
+    concurrent_catalog(const concurrent_catalog&) = delete;
+    concurrent_catalog& operator=(const concurrent_catalog&) = delete;
+    ~concurrent_catalog();
+
+    // Register a reader for the calling thread. A reader must not be used by several threads at the same time, and
+    // must be destroyed before the catalog.
+    [[nodiscard]] reader make_reader();
+
+    // Replace the versions of `package_name` (sorted by this function). An empty list removes the package.
+    void set_versions(std::string_view package_name, std::vector<VersionT> versions);
+    void add_version(std::string_view package_name, const VersionT& version);
+    inline void remove_package(std::string_view package_name) { set_versions(package_name, {}); }
+
+    // Number of replaced buckets not freed yet.
+    std::size_t pending_reclamation_count() const;
+
+private:
+    inline std::atomic<const bucket_*>& bucket_of_(std::string_view package_name)
+    {
+        return buckets_[std::hash<std::string_view>()(package_name) % buckets_.size()];
+    }
+    inline const std::atomic<const bucket_*>& bucket_of_(std::string_view package_name) const
+    {
+        return buckets_[std::hash<std::string_view>()(package_name) % buckets_.size()];
+    }
+
+    static const package_* find_package_(const bucket_* bucket, std::string_view package_name) noexcept;
+    template <class UpdateFunction>
+    void update_package_(std::string_view package_name, UpdateFunction update);
+    void reclaim_();
+
+private:
+    std::vector<std::atomic<const bucket_*>> buckets_;
+    std::atomic<uint64_t> epoch_{ 0 };
+    mutable std::mutex writer_mutex_;
+    std::vector<std::unique_ptr<reader_slot_>> reader_slots_;
+    std::vector<retired_bucket_> retired_buckets_;
+};
+
+template <class VersionT>
+class concurrent_catalog<VersionT>::reader
+{
+public:
+    reader(reader&& other) noexcept : catalog_(std::exchange(other.catalog_, nullptr)), slot_(other.slot_) {}
+    reader& operator=(reader&&) = delete;
+    ~reader();
+
+    // Call `function(std::span<const VersionT>)` with the sorted versions of `package_name` (empty if the package is
+    // unknown), and return its result. The span must not be used after `function` returns. `function` may itself
+    // read through this reader.
+    template <class Function>
+    auto with_versions(std::string_view package_name, Function&& function) const;
+
+    [[nodiscard]] std::vector<VersionT> versions(std::string_view package_name) const;
+    [[nodiscard]] bool contains(std::string_view package_name, const VersionT& version) const;
+    [[nodiscard]] std::optional<VersionT> max(std::string_view package_name) const;
+    // Greatest version of `package_name` compatible with `required` according to `policy`.
+    [[nodiscard]] std::optional<VersionT> max_compatible(std::string_view package_name, const Numver auto& required,
+                                                         compatibility policy = compatibility::major) const;
+
+private:
+    friend class concurrent_catalog;
+    inline reader(const concurrent_catalog* catalog, reader_slot_* slot) noexcept : catalog_(catalog), slot_(slot) {}
+
+    const concurrent_catalog* catalog_;
+    reader_slot_* slot_;
+};
+
+// concurrent_catalog
+
+template <class VersionT>
+concurrent_catalog<VersionT>::concurrent_catalog(std::size_t bucket_count) : buckets_(bucket_count)
+{
+    if (bucket_count == 0)
+        throw std::invalid_argument("The bucket count must not be zero.");
+    for (auto& bucket : buckets_)
+        bucket.store(nullptr, std::memory_order_relaxed);
+}
+
+template <class VersionT>
+concurrent_catalog<VersionT>::~concurrent_catalog()
+{
+    for (auto& bucket : buckets_)
+        delete bucket.load(std::memory_order_relaxed);
+    for (const retired_bucket_& retired : retired_buckets_)
+        delete retired.bucket;
+}
+
+template <class VersionT>
+typename concurrent_catalog<VersionT>::reader concurrent_catalog<VersionT>::make_reader()
+{
+    std::scoped_lock lock(writer_mutex_);
+    auto iter =
+        std::find_if(reader_slots_.begin(), reader_slots_.end(), [](const auto& slot) { return !slot->in_use; });
+    if (iter == reader_slots_.end())
+    {
+        reader_slots_.push_back(std::make_unique<reader_slot_>());
+        iter = std::prev(reader_slots_.end());
+    }
+    (*iter)->in_use = true;
+    return reader(this, iter->get());
+}
+
+template <class VersionT>
+const typename concurrent_catalog<VersionT>::package_*
+concurrent_catalog<VersionT>::find_package_(const bucket_* bucket, std::string_view package_name) noexcept
+{
+    if (!bucket)
+        return nullptr;
+    for (const auto& package : bucket->packages)
+    {
+        if (package->name == package_name)
+            return package.get();
+    }
+    return nullptr;
+}
+
+template <class VersionT>
+template <class UpdateFunction>
+void concurrent_catalog<VersionT>::update_package_(std::string_view package_name, UpdateFunction update)
+{
+    std::scoped_lock lock(writer_mutex_);
+    std::atomic<const bucket_*>& bucket = bucket_of_(package_name);
+    const bucket_* old_bucket = bucket.load(std::memory_order_relaxed);
+
+    auto new_bucket = std::make_unique<bucket_>();
+    std::vector<VersionT> versions;
+    if (old_bucket)
+    {
+        new_bucket->packages.reserve(old_bucket->packages.size() + 1);
+        for (const auto& package : old_bucket->packages)
+        {
+            if (package->name == package_name)
+                versions = package->versions;
+            else
+                new_bucket->packages.push_back(package);
+        }
+    }
+
+    update(versions);
+    if (!versions.empty())
+        new_bucket->packages.push_back(
+            std::make_shared<const package_>(package_{ std::string(package_name), std::move(versions) }));
+
+    bucket.store(new_bucket.release(), std::memory_order_seq_cst);
+    if (old_bucket)
+        retired_buckets_.push_back({ old_bucket, epoch_.fetch_add(1, std::memory_order_seq_cst) });
+    reclaim_();
+}
+
+template <class VersionT>
+void concurrent_catalog<VersionT>::set_versions(std::string_view package_name, std::vector<VersionT> versions)
+{
+    std::stable_sort(versions.begin(), versions.end());
+    update_package_(package_name,
+                    [&](std::vector<VersionT>& package_versions) { package_versions = std::move(versions); });
+}
+
+template <class VersionT>
+void concurrent_catalog<VersionT>::add_version(std::string_view package_name, const VersionT& version)
+{
+    update_package_(package_name,
+                    [&](std::vector<VersionT>& package_versions)
+                    {
+                        package_versions.insert(
+                            std::upper_bound(package_versions.begin(), package_versions.end(), version), version);
+                    });
+}
+
+template <class VersionT>
+void concurrent_catalog<VersionT>::reclaim_()
+{
+    // A bucket retired in epoch E may still be used by the readers which announced an epoch <= E.
+    uint64_t min_reader_epoch = idle_epoch_;
+    for (const auto& slot : reader_slots_)
+        min_reader_epoch = std::min(min_reader_epoch, slot->epoch.load(std::memory_order_seq_cst));
+
+    std::erase_if(retired_buckets_,
+                  [&](const retired_bucket_& retired)
+                  {
+                      if (retired.epoch >= min_reader_epoch)
+                          return false;
+                      delete retired.bucket;
+                      return true;
+                  });
+}
+
+template <class VersionT>
+std::size_t concurrent_catalog<VersionT>::pending_reclamation_count() const
+{
+    std::scoped_lock lock(writer_mutex_);
+    return retired_buckets_.size();
+}
+
+// concurrent_catalog::reader
+
+template <class VersionT>
+concurrent_catalog<VersionT>::reader::~reader()
+{
+    if (catalog_)
+    {
+        std::scoped_lock lock(catalog_->writer_mutex_);
+        slot_->in_use = false;
+    }
+}
+
+template <class VersionT>
+template <class Function>
+auto concurrent_catalog<VersionT>::reader::with_versions(std::string_view package_name, Function&& function) const
+{
+    // A nested call (from `function`) keeps the epoch of the outermost call, whose span must stay valid.
+    struct epoch_guard
+    {
+        std::atomic<uint64_t>& slot_epoch;
+        uint64_t previous_epoch;
+        ~epoch_guard() { slot_epoch.store(previous_epoch, std::memory_order_release); }
+    };
+
+    const uint64_t previous_epoch = slot_->epoch.load(std::memory_order_relaxed);
+    if (previous_epoch == idle_epoch_)
+        slot_->epoch.store(catalog_->epoch_.load(std::memory_order_seq_cst), std::memory_order_seq_cst);
+    epoch_guard guard{ slot_->epoch, previous_epoch };
+    const bucket_* bucket = catalog_->bucket_of_(package_name).load(std::memory_order_seq_cst);
+    const package_* package = find_package_(bucket, package_name);
+    return std::invoke(std::forward<Function>(function),
+                       package ? std::span<const VersionT>(package->versions) : std::span<const VersionT>());
+}
+
+template <class VersionT>
+std::vector<VersionT> concurrent_catalog<VersionT>::reader::versions(std::string_view package_name) const
+{
+    return with_versions(package_name, [](std::span<const VersionT> versions)
+                         { return std::vector<VersionT>(versions.begin(), versions.end()); });
+}
+
+template <class VersionT>
+bool concurrent_catalog<VersionT>::reader::contains(std::string_view package_name, const VersionT& version) const
+{
+    return with_versions(package_name, [&](std::span<const VersionT> versions)
+                         { return std::binary_search(versions.begin(), versions.end(), version); });
+}
+
+template <class VersionT>
+std::optional<VersionT> concurrent_catalog<VersionT>::reader::max(std::string_view package_name) const
+{
+    return with_versions(package_name,
+                         [](std::span<const VersionT> versions) -> std::optional<VersionT>
+                         {
+                             if (versions.empty())
+                                 return std::nullopt;
+                             return versions.back();
+                         });
+}
+
+template <class VersionT>
+std::optional<VersionT> concurrent_catalog<VersionT>::reader::max_compatible(std::string_view package_name,
+                                                                             const Numver auto& required,
+                                                                             compatibility policy) const
+{
+    return with_versions(package_name,
+                         [&](std::span<const VersionT> versions) -> std::optional<VersionT>
+                         {
+                             for (auto iter = versions.rbegin(); iter != versions.rend(); ++iter)
+                             {
+                                 if (is_compatible_with(*iter, required, policy))
+                                     return *iter;
+                             }
+                             return std::nullopt;
+                         });
+}
+
+} // namespace vrsn
+} // namespace arba
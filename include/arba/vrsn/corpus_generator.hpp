@@ -0,0 +1,260 @@
+#pragma once
+
+#include "semver.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+inline namespace arba
+{
+namespace vrsn
+{
+
+enum class corpus_pre_release_style
+{
+    tagged,  // alpha.1, alpha.2, beta.3, rc.4
+    nightly, // nightly.20240101, nightly.20240102, ...
+};
+
+// Distribution of the versions generated by a corpus_generator.
+// The corpus interleaves the release histories of several packages. Each release bumps the patch, minor or major
+// number of the previous release of its package, and may be preceded by a chain of pre-releases. A few packages make
+// most of the releases.
+struct corpus_profile
+{
+    std::size_t package_count = 64;
+    double zero_major_ratio = 0.3;     // packages whose first release is 0.1.0 (else 1.0.0)
+    double major_bump_ratio = 0.03;    // releases bumping the major number
+    double minor_bump_ratio = 0.25;    // releases bumping the minor number (the others bump the patch number)
+    double pre_release_ratio = 0.1;    // releases preceded by pre-releases
+    std::size_t max_pre_releases = 4;  // maximal length of a pre-release chain
+    corpus_pre_release_style pre_release_style = corpus_pre_release_style::tagged;
+    double build_metadata_ratio = 0.0; // versions with CI build metadata ("ci.<run>.g<commit>")
+    double invalid_ratio = 0.0;        // strings which are corrupted versions
+
+    // Many 0.x packages, few pre-releases, almost no build metadata.
+    [[nodiscard]] inline static corpus_profile npm_like()
+    {
+        return corpus_profile{ .package_count = 256,
+                               .zero_major_ratio = 0.35,
+                               .major_bump_ratio = 0.04,
+                               .minor_bump_ratio = 0.25,
+                               .pre_release_ratio = 0.08,
+                               .max_pre_releases = 4,
+                               .build_metadata_ratio = 0.01 };
+    }
+
+    // Mostly 0.x packages, evolving by minor bumps.
+    [[nodiscard]] inline static corpus_profile cargo_like()
+    {
+        return corpus_profile{ .package_count = 128,
+                               .zero_major_ratio = 0.7,
+                               .major_bump_ratio = 0.02,
+                               .minor_bump_ratio = 0.4,
+                               .pre_release_ratio = 0.05,
+                               .max_pre_releases = 3 };
+    }
+
+    // Few packages, long chains of nightly pre-releases, build metadata everywhere.
+    [[nodiscard]] inline static corpus_profile ci_nightly_like()
+    {
+        return corpus_profile{ .package_count = 8,
+                               .zero_major_ratio = 0.1,
+                               .major_bump_ratio = 0.01,
+                               .minor_bump_ratio = 0.1,
+                               .pre_release_ratio = 0.9,
+                               .max_pre_releases = 30,
+                               .pre_release_style = corpus_pre_release_style::nightly,
+                               .build_metadata_ratio = 1.0 };
+    }
+};
+
+// Deterministic generator of version strings: the same profile and the same seed give the same corpus, on every
+// platform (the standard random distributions are implementation-defined, and are not used).
+class corpus_generator
+{
+public:
+    explicit corpus_generator(const corpus_profile& profile = corpus_profile::npm_like(), uint64_t seed = 0);
+
+    // Next version string, which is a valid semantic version unless it belongs to the invalid ratio.
+    [[nodiscard]] std::string next();
+    [[nodiscard]] std::vector<std::string> generate(std::size_t count);
+    // Write `count` newline-terminated strings.
+    void write(std::ostream& stream, std::size_t count);
+    void write(const std::filesystem::path& path, std::size_t count);
+
+    [[nodiscard]] inline const corpus_profile& profile() const noexcept { return profile_; }
+
+private:
+    struct package_
+    {
+        numver last_release;
+        numver next_release;
+        std::size_t pre_release_count = 0; // of the chain preceding next_release
+        std::size_t pre_release_index = 0;
+        bool released = false;
+        bool next_release_planned = false;
+    };
+
+    // splitmix64
+    inline uint64_t random_() noexcept
+    {
+        uint64_t value = (state_ += 0x9e3779b97f4a7c15);
+        value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9;
+        value = (value ^ (value >> 27)) * 0x94d049bb133111eb;
+        return value ^ (value >> 31);
+    }
+    // In [0, count), with a negligible bias for small counts.
+    inline uint64_t below_(uint64_t count) noexcept { return random_() % count; }
+    inline bool chance_(double ratio) noexcept { return static_cast<double>(random_() >> 11) * 0x1.0p-53 < ratio; }
+
+    std::string next_valid_();
+    std::string pre_release_(const package_& package);
+    std::string corrupt_(const std::string& version);
+
+private:
+    corpus_profile profile_;
+    uint64_t state_;
+    std::vector<package_> packages_;
+    uint64_t ci_run_ = 1000;
+    uint64_t nightly_day_ = 0;
+};
+
+inline corpus_generator::corpus_generator(const corpus_profile& profile, uint64_t seed)
+    : profile_(profile), state_(seed), packages_(profile.package_count)
+{
+    if (profile.package_count == 0) [[unlikely]]
+        throw std::invalid_argument("A corpus profile needs at least one package.");
+}
+
+inline std::string corpus_generator::next()
+{
+    std::string version = next_valid_();
+    if (profile_.invalid_ratio > 0 && chance_(profile_.invalid_ratio))
+        return corrupt_(version);
+    return version;
+}
+
+inline std::vector<std::string> corpus_generator::generate(std::size_t count)
+{
+    std::vector<std::string> versions;
+    versions.reserve(count);
+    for (std::size_t i = 0; i < count; ++i)
+        versions.push_back(next());
+    return versions;
+}
+
+inline void corpus_generator::write(std::ostream& stream, std::size_t count)
+{
+    for (std::size_t i = 0; i < count; ++i)
+        stream << next() << '\n';
+}
+
+inline void corpus_generator::write(const std::filesystem::path& path, std::size_t count)
+{
+    std::ofstream stream(path, std::ios::binary);
+    if (!stream) [[unlikely]]
+        throw std::runtime_error("Cannot open file: " + path.string());
+    write(stream, count);
+}
+
+inline std::string corpus_generator::next_valid_()
+{
+    // Squaring a uniform number favors the first packages: a few packages make most of the releases.
+    const double uniform = static_cast<double>(random_() >> 11) * 0x1.0p-53;
+    package_& package = packages_[static_cast<std::size_t>(uniform * uniform * static_cast<double>(packages_.size()))];
+
+    numver version;
+    std::string pre_release;
+    if (!package.released)
+    {
+        package.released = true;
+        package.last_release = chance_(profile_.zero_major_ratio) ? numver(0, 1, 0) : numver(1, 0, 0);
+        version = package.last_release;
+    }
+    else
+    {
+        if (!package.next_release_planned)
+        {
+            package.next_release_planned = true;
+            package.next_release = package.last_release;
+            if (chance_(profile_.major_bump_ratio))
+                package.next_release.up_major();
+            else if (chance_(profile_.minor_bump_ratio))
+                package.next_release.up_minor();
+            else
+                package.next_release.up_patch();
+            package.pre_release_index = 0;
+            package.pre_release_count =
+                profile_.max_pre_releases > 0 && chance_(profile_.pre_release_ratio)
+                    ? 1 + static_cast<std::size_t>(below_(profile_.max_pre_releases))
+                    : 0;
+        }
+        version = package.next_release;
+        if (package.pre_release_index < package.pre_release_count)
+        {
+            pre_release = pre_release_(package);
+            ++package.pre_release_index;
+        }
+        else
+        {
+            package.last_release = package.next_release;
+            package.next_release_planned = false;
+        }
+    }
+
+    std::string build_metadata;
+    if (profile_.build_metadata_ratio > 0 && chance_(profile_.build_metadata_ratio))
+        build_metadata = std::format("ci.{}.g{:07x}", ci_run_++, random_() & 0xfffffff);
+    return std::format("{}", semver(version, pre_release, build_metadata));
+}
+
+inline std::string corpus_generator::pre_release_(const package_& package)
+{
+    if (profile_.pre_release_style == corpus_pre_release_style::nightly)
+    {
+        using namespace std::chrono;
+        const year_month_day date(sys_days(2024y / January / 1) + days(nightly_day_++));
+        return std::format("nightly.{:04}{:02}{:02}", static_cast<int>(date.year()),
+                           static_cast<unsigned>(date.month()), static_cast<unsigned>(date.day()));
+    }
+    static constexpr std::array<const char*, 3> tags{ "alpha", "beta", "rc" };
+    const std::size_t tag = package.pre_release_index * tags.size() / package.pre_release_count;
+    return std::format("{}.{}", tags[tag], package.pre_release_index + 1);
+}
+
+// A string which is not a valid semantic version, made of `version`.
+inline std::string corpus_generator::corrupt_(const std::string& version)
+{
+    const std::size_t core_end = version.find_first_of("-+");
+    const std::string core = version.substr(0, core_end);
+    switch (below_(7))
+    {
+    case 0:
+        return 'v' + version;
+    case 1:
+        return core.substr(0, core.rfind('.'));
+    case 2:
+        return '0' + version;
+    case 3:
+        return core + '-';
+    case 4:
+        return core + "-rc_1";
+    case 5:
+        return core + "-alpha..1";
+    default:
+        return core + ".4";
+    }
+}
+
+} // namespace vrsn
+} // namespace arba
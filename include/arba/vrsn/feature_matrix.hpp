@@ -0,0 +1,199 @@
+#pragma once
+
+#include "numver.hpp"
+#include "vtag.hpp"
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <type_traits>
+
+inline namespace arba
+{
+namespace vrsn
+{
+
+// Marks a feature which is never removed.
+struct not_removed
+{
+};
+
+// Feature `Id` (an enumerator), available from the version Introduced (a vtag) and, if Removed is a vtag, until the
+// version Removed (excluded).
+template <auto Id, class Introduced, class Removed = not_removed>
+    requires std::is_enum_v<decltype(Id)> && Numver<Introduced>
+             && (std::is_same_v<Removed, not_removed> || Numver<Removed>)
+struct feature
+{
+    using id_type = decltype(Id);
+
+    static constexpr id_type id = Id;
+    static constexpr numver introduced = numver(Introduced{});
+    static constexpr std::optional<numver> removed = []
+    {
+        if constexpr (std::is_same_v<Removed, not_removed>)
+            return std::optional<numver>();
+        else
+            return std::optional<numver>(numver(Removed{}));
+    }();
+
+    static_assert(!removed || introduced < *removed, "A feature must be removed after its introduction.");
+
+    // Only the version core of `version` is considered.
+    [[nodiscard]] inline static constexpr bool is_available_in(const Numver auto& version) noexcept
+    {
+        const numver core(version);
+        return !(core < introduced) && (!removed || core < *removed);
+    }
+};
+
+// Set of features, indexed by the enumerators identifying them.
+template <class Enum, std::size_t Size>
+    requires std::is_enum_v<Enum>
+class feature_set
+{
+public:
+    static constexpr std::size_t size = Size;
+
+    constexpr feature_set() = default;
+
+    [[nodiscard]] inline constexpr bool test(Enum id) const noexcept
+    {
+        const std::size_t index = index_(id);
+        return (words_[index / 64] >> (index % 64)) & 1;
+    }
+    inline constexpr feature_set& set(Enum id) noexcept
+    {
+        const std::size_t index = index_(id);
+        words_[index / 64] |= uint64_t(1) << (index % 64);
+        return *this;
+    }
+
+    [[nodiscard]] inline constexpr std::size_t count() const noexcept
+    {
+        std::size_t count = 0;
+        for (uint64_t word : words_)
+            count += static_cast<std::size_t>(std::popcount(word));
+        return count;
+    }
+    [[nodiscard]] inline constexpr bool none() const noexcept { return count() == 0; }
+    // True if every feature of `other` is in this set.
+    [[nodiscard]] inline constexpr bool contains(const feature_set& other) const noexcept
+    {
+        for (std::size_t index = 0; index < words_.size(); ++index)
+        {
+            if ((other.words_[index] & ~words_[index]) != 0)
+                return false;
+        }
+        return true;
+    }
+
+    [[nodiscard]] inline constexpr friend feature_set operator&(feature_set lhs, const feature_set& rhs) noexcept
+    {
+        for (std::size_t index = 0; index < lhs.words_.size(); ++index)
+            lhs.words_[index] &= rhs.words_[index];
+        return lhs;
+    }
+    [[nodiscard]] inline constexpr friend feature_set operator|(feature_set lhs, const feature_set& rhs) noexcept
+    {
+        for (std::size_t index = 0; index < lhs.words_.size(); ++index)
+            lhs.words_[index] |= rhs.words_[index];
+        return lhs;
+    }
+
+    bool operator==(const feature_set&) const = default;
+
+private:
+    inline static constexpr std::size_t index_(Enum id) noexcept
+    {
+        return static_cast<std::size_t>(static_cast<std::underlying_type_t<Enum>>(id));
+    }
+
+    std::array<uint64_t, (Size + 63) / 64> words_{};
+};
+
+// Features of a protocol (or of a file format, ...) with the versions introducing and removing them.
+// A version is evaluated to the set of its features: at compile time for a vtag, and once per runtime version (e.g.
+// once per peer), so that hot paths test a bit instead of comparing versions.
+//
+//   enum class protocol_feature { compression, streaming, legacy_auth };
+//   using protocol_features = feature_matrix<protocol_feature,
+//                                            feature<protocol_feature::compression, vtag<1, 2, 0>>,
+//                                            feature<protocol_feature::streaming, vtag<2, 0, 0>>,
+//                                            feature<protocol_feature::legacy_auth, vtag<1, 0, 0>, vtag<3, 0, 0>>>;
+//   static_assert(protocol_features::set_of<vtag<2, 1, 0>>.test(protocol_feature::streaming));
+//   const auto peer_features = protocol_features::evaluate(peer_version);
+//
+// The enumerators must be the integers [0, number of features), in any order.
+template <class Enum, class... Features>
+    requires std::is_enum_v<Enum> && (std::is_same_v<typename Features::id_type, Enum> && ...)
+class feature_matrix
+{
+public:
+    using id_type = Enum;
+    using set_type = feature_set<Enum, sizeof...(Features)>;
+
+    static constexpr std::size_t size = sizeof...(Features);
+
+    [[nodiscard]] inline static constexpr set_type evaluate(const Numver auto& version) noexcept
+    {
+        set_type features;
+        ((Features::is_available_in(version) ? void(features.set(Features::id)) : void()), ...);
+        return features;
+    }
+
+    // Features of the compile-time version VersionTag.
+    template <class VersionTag>
+    static constexpr set_type set_of = evaluate(VersionTag{});
+
+    // All the features.
+    static constexpr set_type all = []
+    {
+        set_type features;
+        (features.set(Features::id), ...);
+        return features;
+    }();
+
+    [[nodiscard]] inline static constexpr numver introduced(Enum id) noexcept
+    {
+        return bounds_[index_(id)].introduced;
+    }
+
+    [[nodiscard]] inline static constexpr std::optional<numver> removed(Enum id) noexcept
+    {
+        const bounds& feature_bounds = bounds_[index_(id)];
+        return feature_bounds.is_removed ? std::optional<numver>(feature_bounds.removed) : std::nullopt;
+    }
+
+private:
+    struct bounds
+    {
+        numver introduced;
+        numver removed;
+        bool is_removed = false;
+    };
+
+    inline static constexpr std::size_t index_(Enum id) noexcept
+    {
+        return static_cast<std::size_t>(static_cast<std::underlying_type_t<Enum>>(id));
+    }
+
+    static_assert(((index_(Features::id) < size) && ...),
+                  "The identifiers of the features must be less than the number of features.");
+    static_assert(all.count() == size, "The features must have distinct identifiers.");
+
+    // Indexed by identifier.
+    static constexpr std::array<bounds, size> bounds_ = []
+    {
+        std::array<bounds, size> features_bounds;
+        ((features_bounds[index_(Features::id)] =
+              bounds{ Features::introduced, Features::removed.value_or(numver()), Features::removed.has_value() }),
+         ...);
+        return features_bounds;
+    }();
+};
+
+} // namespace vrsn
+} // namespace arba
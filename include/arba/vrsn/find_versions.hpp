@@ -0,0 +1,141 @@
+#pragma once
+
+#include "semver_view.hpp"
+
+#include <bit>
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define ARBA_VRSN_HAS_SSE2 1
+#else
+#define ARBA_VRSN_HAS_SSE2 0
+#endif
+
+inline namespace arba
+{
+namespace vrsn
+{
+
+struct version_match
+{
+    std::size_t offset = 0; // position of the token in the scanned text
+    std::string_view text;  // the token, including its optional 'v' prefix
+    semver_view version;    // refers to the scanned text
+};
+
+namespace private_
+{
+
+// First digit in [first, last), or last.
+[[nodiscard]] inline const char* find_digit_(const char* first, const char* last) noexcept
+{
+#if ARBA_VRSN_HAS_SSE2
+    const __m128i zero_char = _mm_set1_epi8('0');
+    const __m128i nine = _mm_set1_epi8(9);
+    for (; last - first >= 16; first += 16)
+    {
+        const __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+        const __m128i offsets = _mm_sub_epi8(chars, zero_char);
+        // Digits are the bytes for which (ch - '0') is in [0, 9] as an unsigned value.
+        const int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_min_epu8(offsets, nine), offsets));
+        if (mask != 0)
+            return first + std::countr_zero(static_cast<unsigned>(mask));
+    }
+#endif
+    for (; first != last; ++first)
+    {
+        if (is_digit_(*first))
+            return first;
+    }
+    return last;
+}
+
+[[nodiscard]] inline constexpr bool is_semver_char_(char ch) noexcept
+{
+    return is_alphanum_(ch) || ch == '.' || ch == '+';
+}
+
+// A version may not be preceded by one of these characters.
+[[nodiscard]] inline constexpr bool is_left_word_char_(char ch) noexcept
+{
+    return is_digit_(ch) || (ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z') || ch == '_' || ch == '.';
+}
+
+// Call `callback(const char* token_begin, std::string_view version_text)` for each candidate token of `text`, in
+// order: see for_each_version(). `token_begin` includes the optional 'v' prefix, `version_text` does not.
+template <class Callback>
+void for_each_version_token_(std::string_view text, Callback&& callback)
+{
+    const char* const begin = text.data();
+    const char* const end = begin + text.size();
+    const char* iter = begin;
+    while ((iter = find_digit_(iter, end)) != end)
+    {
+        const char* token_begin = iter;
+        if (token_begin != begin)
+        {
+            const char previous = token_begin[-1];
+            if (previous == 'v' || previous == 'V')
+            {
+                --token_begin;
+                if (token_begin != begin && is_left_word_char_(token_begin[-1]))
+                {
+                    ++iter;
+                    continue;
+                }
+            }
+            else if (is_left_word_char_(previous))
+            {
+                ++iter;
+                continue;
+            }
+        }
+
+        const char* run_end = iter;
+        while (run_end != end && is_semver_char_(*run_end))
+            ++run_end;
+        const char* token_end = run_end;
+        while (*(token_end - 1) == '.' || *(token_end - 1) == '-' || *(token_end - 1) == '+')
+            --token_end;
+
+        if (run_end == end || *run_end != '_')
+            callback(token_begin, std::string_view(iter, token_end));
+        iter = run_end;
+    }
+}
+
+} // namespace private_
+
+// Call `callback(const version_match&)` for each maximal valid semantic version token of `text`, in order.
+// A token is a run of semantic version characters which starts with a digit (optionally preceded by 'v' or 'V') and
+// which is not glued to a surrounding word: "pkg-1.2.3", "v2.0.0-rc.1", "(0.4.1)" match, "x1.2.3" or "1.2.3.4" do not.
+// Trailing '.', '-' or '+' are not part of the token ("version 1.2.3." matches "1.2.3").
+template <class Callback>
+void for_each_version(std::string_view text, Callback&& callback)
+{
+    private_::for_each_version_token_(text,
+                                      [&](const char* token_begin, std::string_view version_text)
+                                      {
+                                          semver_view version;
+                                          if (private_::extract_semver_view_(version_text, version))
+                                          {
+                                              const char* const token_end = version_text.data() + version_text.size();
+                                              callback(version_match{
+                                                  static_cast<std::size_t>(token_begin - text.data()),
+                                                  std::string_view(token_begin, token_end), version });
+                                          }
+                                      });
+}
+
+[[nodiscard]] inline std::vector<version_match> find_versions(std::string_view text)
+{
+    std::vector<version_match> matches;
+    for_each_version(text, [&](const version_match& match) { matches.push_back(match); });
+    return matches;
+}
+
+} // namespace vrsn
+} // namespace arba
@@ -0,0 +1,613 @@
+#pragma once
+
+#include "_private/parallel_for.hpp"
+#include "find_versions.hpp"
+#include "semver_view.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+inline namespace arba
+{
+namespace vrsn
+{
+
+// Source of the text read by ingest(). next_chunk() is called from a single coroutine at a time.
+class ingestion_source
+{
+public:
+    virtual ~ingestion_source() = default;
+    // Next chunk of text, or none at the end of the input. A version may be split between two chunks.
+    [[nodiscard]] virtual std::optional<std::string> next_chunk() = 0;
+};
+
+// Destination of the versions found by ingest(). consume() is called from a single coroutine at a time.
+class ingestion_sink
+{
+public:
+    virtual ~ingestion_sink() = default;
+    virtual void consume(std::vector<semver> versions) = 0;
+};
+
+class file_source : public ingestion_source
+{
+public:
+    inline explicit file_source(const std::filesystem::path& path, std::size_t chunk_size = 64 * 1024)
+        : stream_(path, std::ios::binary), chunk_size_(std::max<std::size_t>(chunk_size, 1))
+    {
+        if (!stream_) [[unlikely]]
+            throw std::runtime_error("Cannot open file: " + path.string());
+    }
+
+    [[nodiscard]] inline std::optional<std::string> next_chunk() override
+    {
+        std::string chunk(chunk_size_, '\0');
+        stream_.read(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+        chunk.resize(static_cast<std::size_t>(stream_.gcount()));
+        if (chunk.empty())
+            return std::nullopt;
+        return chunk;
+    }
+
+private:
+    std::ifstream stream_;
+    std::size_t chunk_size_;
+};
+
+class memory_sink : public ingestion_sink
+{
+public:
+    inline void consume(std::vector<semver> versions) override
+    {
+        versions_.insert(versions_.end(), std::make_move_iterator(versions.begin()),
+                         std::make_move_iterator(versions.end()));
+    }
+
+    [[nodiscard]] inline const std::vector<semver>& versions() const noexcept { return versions_; }
+    [[nodiscard]] inline std::vector<semver> take_versions() noexcept { return std::move(versions_); }
+
+private:
+    std::vector<semver> versions_;
+};
+
+struct ingestion_options
+{
+    unsigned thread_count = 0;         // 0: std::thread::hardware_concurrency()
+    std::size_t queue_capacity = 8;    // maximum number of batches waiting between two stages
+    std::size_t max_token_size = 1024; // longer runs of token characters are skipped
+};
+
+struct ingestion_stats
+{
+    std::size_t chunk_count = 0;
+    std::size_t token_count = 0;     // candidate versions (see find_versions())
+    std::size_t invalid_count = 0;   // tokens which are not valid semantic versions
+    std::size_t duplicate_count = 0; // versions already seen (same precedence and same build metadata)
+    std::size_t version_count = 0;   // versions sent to the sink
+};
+
+namespace private_
+{
+
+// Thread pool resuming coroutines.
+class ingestion_executor_
+{
+public:
+    inline explicit ingestion_executor_(unsigned thread_count)
+    {
+        const unsigned count = resolve_thread_count_(thread_count);
+        threads_.reserve(count);
+        for (unsigned i = 0; i < count; ++i)
+            threads_.emplace_back([this] { run_(); });
+    }
+
+    inline ~ingestion_executor_()
+    {
+        {
+            std::scoped_lock lock(mutex_);
+            stopping_ = true;
+        }
+        condition_.notify_all();
+    }
+
+    inline void schedule(std::coroutine_handle<> handle)
+    {
+        {
+            std::scoped_lock lock(mutex_);
+            ready_.push_back(handle);
+        }
+        condition_.notify_one();
+    }
+
+    // Awaitable resuming the awaiting coroutine on a thread of the pool.
+    inline auto schedule() noexcept
+    {
+        struct awaiter
+        {
+            ingestion_executor_* executor;
+            inline bool await_ready() const noexcept { return false; }
+            inline void await_suspend(std::coroutine_handle<> handle) const { executor->schedule(handle); }
+            inline void await_resume() const noexcept {}
+        };
+        return awaiter{ this };
+    }
+
+private:
+    inline void run_()
+    {
+        for (;;)
+        {
+            std::coroutine_handle<> handle;
+            {
+                std::unique_lock lock(mutex_);
+                condition_.wait(lock, [this] { return stopping_ || !ready_.empty(); });
+                if (ready_.empty())
+                    return;
+                handle = ready_.front();
+                ready_.pop_front();
+            }
+            handle.resume();
+        }
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    std::deque<std::coroutine_handle<>> ready_;
+    bool stopping_ = false;
+    std::vector<std::jthread> threads_; // last member: joined first
+};
+
+// Queue between two coroutines: push() suspends the producer while the queue is full, pop() suspends the consumer
+// while it is empty. Suspended coroutines are resumed by the executor.
+template <class T>
+class async_bounded_queue_
+{
+public:
+    class push_awaiter
+    {
+    public:
+        inline bool await_ready() const noexcept { return false; }
+        inline bool await_suspend(std::coroutine_handle<> handle)
+        {
+            std::scoped_lock lock(queue_.mutex_);
+            if (queue_.closed_)
+                return false;
+            pushed_ = true;
+            if (queue_.items_.size() < queue_.capacity_)
+            {
+                queue_.items_.push_back(std::move(value_));
+                queue_.wake_consumer_();
+                return false;
+            }
+            handle_ = handle;
+            queue_.producers_.push_back(this);
+            return true;
+        }
+        // False if the queue is closed (the value is dropped).
+        inline bool await_resume() const noexcept { return pushed_; }
+
+    private:
+        friend class async_bounded_queue_;
+        inline push_awaiter(async_bounded_queue_& queue, T value) : queue_(queue), value_(std::move(value)) {}
+
+        async_bounded_queue_& queue_;
+        T value_;
+        std::coroutine_handle<> handle_;
+        bool pushed_ = false;
+    };
+
+    class pop_awaiter
+    {
+    public:
+        inline bool await_ready() const noexcept { return false; }
+        inline bool await_suspend(std::coroutine_handle<> handle)
+        {
+            std::scoped_lock lock(queue_.mutex_);
+            if (!queue_.items_.empty())
+            {
+                value_ = queue_.take_();
+                return false;
+            }
+            if (queue_.closed_)
+                return false;
+            handle_ = handle;
+            queue_.consumer_ = this;
+            return true;
+        }
+        // None once the queue is closed and empty.
+        inline std::optional<T> await_resume() { return std::move(value_); }
+
+    private:
+        friend class async_bounded_queue_;
+        inline explicit pop_awaiter(async_bounded_queue_& queue) : queue_(queue) {}
+
+        async_bounded_queue_& queue_;
+        std::optional<T> value_;
+        std::coroutine_handle<> handle_;
+    };
+
+    inline async_bounded_queue_(ingestion_executor_& executor, std::size_t capacity)
+        : executor_(executor), capacity_(std::max<std::size_t>(capacity, 1))
+    {
+    }
+
+    [[nodiscard]] inline push_awaiter push(T value) { return push_awaiter(*this, std::move(value)); }
+    // A queue has a single consumer.
+    [[nodiscard]] inline pop_awaiter pop() { return pop_awaiter(*this); }
+
+    // Wake the waiting coroutines: the remaining items can still be popped, but pushes fail.
+    inline void close()
+    {
+        std::scoped_lock lock(mutex_);
+        closed_ = true;
+        for (push_awaiter* producer : producers_)
+        {
+            producer->pushed_ = false;
+            executor_.schedule(producer->handle_);
+        }
+        producers_.clear();
+        wake_consumer_();
+    }
+
+private:
+    // With the mutex locked:
+
+    inline T take_()
+    {
+        T item = std::move(items_.front());
+        items_.pop_front();
+        if (!producers_.empty())
+        {
+            push_awaiter* producer = producers_.front();
+            producers_.pop_front();
+            items_.push_back(std::move(producer->value_));
+            executor_.schedule(producer->handle_);
+        }
+        return item;
+    }
+
+    inline void wake_consumer_()
+    {
+        if (!consumer_)
+            return;
+        pop_awaiter* consumer = std::exchange(consumer_, nullptr);
+        if (!items_.empty())
+            consumer->value_ = take_();
+        executor_.schedule(consumer->handle_);
+    }
+
+private:
+    ingestion_executor_& executor_;
+    std::size_t capacity_;
+    std::mutex mutex_;
+    std::deque<T> items_;
+    bool closed_ = false;
+    std::deque<push_awaiter*> producers_;
+    pop_awaiter* consumer_ = nullptr;
+};
+
+// Coroutine started by the executor, and signaling its end to a counter.
+struct ingestion_task_
+{
+    struct completion
+    {
+        std::mutex mutex;
+        std::condition_variable condition;
+        std::size_t running_count = 0;
+
+        inline void wait()
+        {
+            std::unique_lock lock(mutex);
+            condition.wait(lock, [this] { return running_count == 0; });
+        }
+    };
+
+    struct promise_type
+    {
+        completion* done = nullptr;
+
+        inline ingestion_task_ get_return_object() noexcept
+        {
+            return { std::coroutine_handle<promise_type>::from_promise(*this) };
+        }
+        inline std::suspend_always initial_suspend() const noexcept { return {}; }
+        inline auto final_suspend() const noexcept
+        {
+            struct awaiter
+            {
+                inline bool await_ready() const noexcept { return false; }
+                inline void await_suspend(std::coroutine_handle<promise_type> handle) const noexcept
+                {
+                    completion& done = *handle.promise().done;
+                    std::scoped_lock lock(done.mutex);
+                    if (--done.running_count == 0)
+                        done.condition.notify_all();
+                }
+                inline void await_resume() const noexcept {}
+            };
+            return awaiter{};
+        }
+        inline void return_void() const noexcept {}
+        // Stages catch their exceptions.
+        inline void unhandled_exception() const noexcept { std::terminate(); }
+    };
+
+    std::coroutine_handle<promise_type> handle;
+};
+
+// Version tokens of find_versions() (the 'v' prefix removed), valid or not. A chunk is scanned up to its last
+// character which cannot be part of a token; the rest, with this character as left context, is kept until the next
+// chunk, or finish(). A run of token characters longer than `max_token_size` is skipped.
+class version_tokenizer_
+{
+public:
+    inline explicit version_tokenizer_(std::size_t max_token_size) : max_token_size_(max_token_size) {}
+
+    // Tokens ending in `chunk`.
+    inline std::vector<std::string> feed(std::string_view chunk)
+    {
+        std::vector<std::string> tokens;
+        if (skips_run_)
+        {
+            const auto run_end = std::find_if_not(chunk.begin(), chunk.end(), is_semver_char_);
+            chunk.remove_prefix(static_cast<std::size_t>(run_end - chunk.begin()));
+            if (chunk.empty())
+                return tokens;
+            skips_run_ = false;
+        }
+        pending_ += chunk;
+        const auto last_separator = std::find_if_not(pending_.rbegin(), pending_.rend(), is_semver_char_);
+        if (last_separator != pending_.rend())
+        {
+            const std::size_t tail_pos = static_cast<std::size_t>(pending_.rend() - last_separator) - 1;
+            scan_(std::string_view(pending_).substr(0, tail_pos + 1), tokens);
+            pending_.erase(0, tail_pos);
+        }
+        // The kept run of token characters follows its left context (if any).
+        if (pending_.size() > max_token_size_ + 1)
+        {
+            pending_.clear();
+            skips_run_ = true;
+        }
+        return tokens;
+    }
+
+    inline std::vector<std::string> finish()
+    {
+        std::vector<std::string> tokens;
+        scan_(pending_, tokens);
+        pending_.clear();
+        return tokens;
+    }
+
+private:
+    inline static void scan_(std::string_view text, std::vector<std::string>& tokens)
+    {
+        for_each_version_token_(text, [&](const char*, std::string_view version_text)
+                                { tokens.emplace_back(version_text); });
+    }
+
+    std::size_t max_token_size_;
+    std::string pending_;
+    bool skips_run_ = false;
+};
+
+struct semver_identity_hash_
+{
+    inline std::size_t operator()(const semver& version) const noexcept
+    {
+        std::size_t hash = std::hash<uint64_t>()(version.major());
+        hash = hash * 31 + version.minor();
+        hash = hash * 31 + version.patch();
+        hash = hash * 31 + std::hash<std::string_view>()(version.pre_release());
+        return hash * 31 + std::hash<std::string_view>()(version.build_metadata());
+    }
+};
+
+struct semver_identity_equal_
+{
+    inline bool operator()(const semver& lv, const semver& rv) const noexcept
+    {
+        return lv == rv && lv.build_metadata() == rv.build_metadata();
+    }
+};
+
+class ingestion_pipeline_
+{
+public:
+    inline ingestion_pipeline_(ingestion_source& source, ingestion_sink& sink, const ingestion_options& options)
+        : source_(source), sink_(sink), executor_(options.thread_count), chunks_(executor_, options.queue_capacity),
+          tokens_(executor_, options.queue_capacity), valid_versions_(executor_, options.queue_capacity),
+          unique_versions_(executor_, options.queue_capacity), max_token_size_(options.max_token_size)
+    {
+    }
+
+    inline ingestion_stats run()
+    {
+        ingestion_task_::completion done;
+        std::vector<ingestion_task_> tasks{ read_(), tokenize_(), validate_(), dedupe_(), write_() };
+        done.running_count = tasks.size();
+        for (ingestion_task_& task : tasks)
+        {
+            task.handle.promise().done = &done;
+            executor_.schedule(task.handle);
+        }
+        done.wait();
+        for (ingestion_task_& task : tasks)
+            task.handle.destroy();
+        if (error_)
+            std::rethrow_exception(error_);
+        return stats_;
+    }
+
+private:
+    // Record the first error, and close all the queues so that every stage ends.
+    inline void fail_(std::exception_ptr error)
+    {
+        {
+            std::scoped_lock lock(error_mutex_);
+            if (!error_)
+                error_ = error;
+        }
+        chunks_.close();
+        tokens_.close();
+        valid_versions_.close();
+        unique_versions_.close();
+    }
+
+    inline ingestion_task_ read_()
+    {
+        try
+        {
+            while (std::optional<std::string> chunk = source_.next_chunk())
+            {
+                ++stats_.chunk_count;
+                if (!co_await chunks_.push(std::move(*chunk)))
+                    break;
+            }
+        }
+        catch (...)
+        {
+            fail_(std::current_exception());
+        }
+        chunks_.close();
+    }
+
+    inline ingestion_task_ tokenize_()
+    {
+        try
+        {
+            version_tokenizer_ tokenizer(max_token_size_);
+            bool is_open = true;
+            while (std::optional<std::string> chunk = co_await chunks_.pop())
+            {
+                std::vector<std::string> tokens = tokenizer.feed(*chunk);
+                if (!tokens.empty() && !(is_open = co_await tokens_.push(std::move(tokens))))
+                    break;
+            }
+            if (std::vector<std::string> tokens = tokenizer.finish(); is_open && !tokens.empty())
+                co_await tokens_.push(std::move(tokens));
+        }
+        catch (...)
+        {
+            fail_(std::current_exception());
+        }
+        tokens_.close();
+    }
+
+    inline ingestion_task_ validate_()
+    {
+        try
+        {
+            while (std::optional<std::vector<std::string>> tokens = co_await tokens_.pop())
+            {
+                std::vector<semver> versions;
+                versions.reserve(tokens->size());
+                for (const std::string& token : *tokens)
+                {
+                    semver_view version;
+                    if (extract_semver_view_(token, version))
+                        versions.push_back(version.to_semver());
+                }
+                stats_.token_count += tokens->size();
+                stats_.invalid_count += tokens->size() - versions.size();
+                if (!versions.empty() && !co_await valid_versions_.push(std::move(versions)))
+                    break;
+            }
+        }
+        catch (...)
+        {
+            fail_(std::current_exception());
+        }
+        valid_versions_.close();
+    }
+
+    inline ingestion_task_ dedupe_()
+    {
+        try
+        {
+            std::unordered_set<semver, semver_identity_hash_, semver_identity_equal_> seen;
+            while (std::optional<std::vector<semver>> versions = co_await valid_versions_.pop())
+            {
+                std::vector<semver> unique_versions;
+                for (semver& version : *versions)
+                {
+                    if (seen.insert(version).second)
+                        unique_versions.push_back(std::move(version));
+                    else
+                        ++stats_.duplicate_count;
+                }
+                if (!unique_versions.empty() && !co_await unique_versions_.push(std::move(unique_versions)))
+                    break;
+            }
+        }
+        catch (...)
+        {
+            fail_(std::current_exception());
+        }
+        unique_versions_.close();
+    }
+
+    inline ingestion_task_ write_()
+    {
+        try
+        {
+            while (std::optional<std::vector<semver>> versions = co_await unique_versions_.pop())
+            {
+                stats_.version_count += versions->size();
+                sink_.consume(std::move(*versions));
+            }
+        }
+        catch (...)
+        {
+            fail_(std::current_exception());
+        }
+        co_return;
+    }
+
+private:
+    ingestion_source& source_;
+    ingestion_sink& sink_;
+    ingestion_stats stats_; // each counter is updated by a single stage
+    std::mutex error_mutex_;
+    std::exception_ptr error_;
+    ingestion_executor_ executor_;
+    async_bounded_queue_<std::string> chunks_;
+    async_bounded_queue_<std::vector<std::string>> tokens_;
+    async_bounded_queue_<std::vector<semver>> valid_versions_;
+    async_bounded_queue_<std::vector<semver>> unique_versions_;
+    std::size_t max_token_size_;
+};
+
+} // namespace private_
+
+// Read the text of `source`, extract its version tokens with the rules of find_versions() ("zlib-1.2.3" and "v1.2.3"
+// hold "1.2.3", "x1.2.3" holds none), keep the valid semantic versions, drop the duplicates, and send the remaining
+// versions to `sink`, in input order.
+// Each step is a coroutine running on a small thread pool, and consecutive steps are connected by bounded queues of
+// batches: a slow step suspends the previous ones (backpressure) while I/O and parsing overlap.
+// Rethrow the first exception thrown by the source or the sink.
+inline ingestion_stats ingest(ingestion_source& source, ingestion_sink& sink, const ingestion_options& options = {})
+{
+    return private_::ingestion_pipeline_(source, sink, options).run();
+}
+
+} // namespace vrsn
+} // namespace arba
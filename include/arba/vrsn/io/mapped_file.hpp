@@ -0,0 +1,121 @@
+#pragma once
+
+#include <cerrno>
+#include <cstddef>
+#include <filesystem>
+#include <span>
+#include <system_error>
+#include <utility>
+
+#if __has_include(<sys/mman.h>)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define ARBA_VRSN_HAS_MMAP 1
+#else
+#include <fstream>
+#include <iterator>
+#include <vector>
+#define ARBA_VRSN_HAS_MMAP 0
+#endif
+
+inline namespace arba
+{
+namespace vrsn
+{
+
+// Read-only view of a whole file. The file is memory-mapped where the platform supports it (pages are then shared
+// between the processes mapping the same file), and read into memory otherwise.
+class mapped_file
+{
+public:
+    mapped_file() = default;
+    explicit mapped_file(const std::filesystem::path& path);
+    mapped_file(const mapped_file&) = delete;
+    mapped_file& operator=(const mapped_file&) = delete;
+    mapped_file(mapped_file&& other) noexcept { swap(other); }
+    mapped_file& operator=(mapped_file&& other) noexcept
+    {
+        mapped_file(std::move(other)).swap(*this);
+        return *this;
+    }
+    ~mapped_file();
+
+    inline std::span<const std::byte> bytes() const noexcept { return { data_, size_ }; }
+    inline std::size_t size() const noexcept { return size_; }
+    inline bool empty() const noexcept { return size_ == 0; }
+
+    inline void swap(mapped_file& other) noexcept
+    {
+        std::swap(data_, other.data_);
+        std::swap(size_, other.size_);
+#if !ARBA_VRSN_HAS_MMAP
+        std::swap(buffer_, other.buffer_);
+#endif
+    }
+
+private:
+    const std::byte* data_ = nullptr;
+    std::size_t size_ = 0;
+#if !ARBA_VRSN_HAS_MMAP
+    std::vector<std::byte> buffer_;
+#endif
+};
+
+#if ARBA_VRSN_HAS_MMAP
+
+inline mapped_file::mapped_file(const std::filesystem::path& path)
+{
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        throw std::system_error(errno, std::generic_category(), path.string());
+
+    struct ::stat file_stat;
+    if (::fstat(fd, &file_stat) != 0)
+    {
+        const int error = errno;
+        ::close(fd);
+        throw std::system_error(error, std::generic_category(), path.string());
+    }
+
+    if (file_stat.st_size > 0)
+    {
+        void* address = ::mmap(nullptr, static_cast<std::size_t>(file_stat.st_size), PROT_READ, MAP_SHARED, fd, 0);
+        if (address == MAP_FAILED)
+        {
+            const int error = errno;
+            ::close(fd);
+            throw std::system_error(error, std::generic_category(), path.string());
+        }
+        data_ = static_cast<const std::byte*>(address);
+        size_ = static_cast<std::size_t>(file_stat.st_size);
+    }
+    ::close(fd);
+}
+
+inline mapped_file::~mapped_file()
+{
+    if (data_)
+        ::munmap(const_cast<std::byte*>(data_), size_);
+}
+
+#else
+
+inline mapped_file::mapped_file(const std::filesystem::path& path)
+{
+    std::ifstream stream(path, std::ios::binary);
+    if (!stream)
+        throw std::system_error(std::make_error_code(std::errc::no_such_file_or_directory), path.string());
+    buffer_.resize(static_cast<std::size_t>(std::filesystem::file_size(path)));
+    stream.read(reinterpret_cast<char*>(buffer_.data()), static_cast<std::streamsize>(buffer_.size()));
+    data_ = buffer_.data();
+    size_ = buffer_.size();
+}
+
+inline mapped_file::~mapped_file() = default;
+
+#endif
+
+} // namespace vrsn
+} // namespace arba
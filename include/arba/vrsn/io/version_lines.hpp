@@ -0,0 +1,224 @@
+#pragma once
+
+#include <arba/vrsn/semver_view.hpp>
+#include <cstddef>
+#include <cstring>
+#include <istream>
+#include <iterator>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+inline namespace arba
+{
+namespace vrsn
+{
+
+// A line of a newline-delimited version file.
+struct version_line
+{
+    std::size_t line_number = 0; // 1-based
+    std::string_view text;       // without the end of line ("\n" or "\r\n")
+    semver_view version;         // meaningful only if `valid`
+    bool valid = false;
+};
+
+namespace private_
+{
+
+inline void parse_version_line_(version_line& line, std::string_view text)
+{
+    if (!text.empty() && text.back() == '\r')
+        text.remove_suffix(1);
+    line.text = text;
+    line.valid = extract_semver_view_(text, line.version);
+}
+
+template <class LineSource>
+class version_line_iterator
+{
+public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = version_line;
+    using difference_type = std::ptrdiff_t;
+
+    version_line_iterator() = default;
+    inline explicit version_line_iterator(LineSource& source) : source_(&source) { ++*this; }
+
+    inline const version_line& operator*() const noexcept { return line_; }
+    inline const version_line* operator->() const noexcept { return &line_; }
+    inline version_line_iterator& operator++()
+    {
+        if (!source_->next(line_))
+            source_ = nullptr;
+        return *this;
+    }
+    inline void operator++(int) { ++*this; }
+    inline bool operator==(std::default_sentinel_t) const noexcept { return source_ == nullptr; }
+
+private:
+    LineSource* source_ = nullptr;
+    version_line line_;
+};
+
+} // namespace private_
+
+// Lines of an in-memory text (e.g. the bytes of a mapped_file), parsed lazily. Empty lines are skipped.
+// The text of each line and its version refer to the input text. Lines may end with another delimiter than '\n'.
+class version_lines
+{
+public:
+    using iterator = private_::version_line_iterator<version_lines>;
+
+    inline explicit version_lines(std::string_view text, char delimiter = '\n') noexcept
+        : text_(text), delimiter_(delimiter)
+    {
+    }
+    inline explicit version_lines(std::span<const std::byte> bytes, char delimiter = '\n') noexcept
+        : version_lines(std::string_view(reinterpret_cast<const char*>(bytes.data()), bytes.size()), delimiter)
+    {
+    }
+
+    inline iterator begin() { return iterator(*this); }
+    inline std::default_sentinel_t end() const noexcept { return std::default_sentinel; }
+
+    bool next(version_line& line);
+    // Number of lines consumed so far, empty lines included.
+    inline std::size_t line_count() const noexcept { return line_number_; }
+
+private:
+    std::string_view text_;
+    std::size_t line_number_ = 0;
+    char delimiter_;
+};
+
+inline bool version_lines::next(version_line& line)
+{
+    while (!text_.empty())
+    {
+        const std::size_t eol_pos = text_.find(delimiter_);
+        const std::string_view text = text_.substr(0, eol_pos);
+        text_.remove_prefix(eol_pos == std::string_view::npos ? text_.size() : eol_pos + 1);
+        ++line_number_;
+        if (text.empty() || text == "\r")
+            continue;
+        line.line_number = line_number_;
+        private_::parse_version_line_(line, text);
+        return true;
+    }
+    return false;
+}
+
+// Lines of a stream, read through a fixed-size buffer: memory use does not depend on the stream size.
+// Empty lines are skipped. Lines longer than the buffer are reported as invalid, with their text truncated.
+// The text of a line and its version are valid until the next line is read.
+class version_line_reader
+{
+public:
+    using iterator = private_::version_line_iterator<version_line_reader>;
+
+    static constexpr std::size_t default_buffer_size = 64 * 1024;
+
+    inline explicit version_line_reader(std::istream& stream, std::size_t buffer_size = default_buffer_size)
+        : stream_(stream), buffer_(buffer_size)
+    {
+        if (buffer_size == 0)
+            throw std::invalid_argument("The buffer size must not be zero.");
+    }
+
+    inline iterator begin() { return iterator(*this); }
+    inline std::default_sentinel_t end() const noexcept { return std::default_sentinel; }
+
+    bool next(version_line& line);
+
+private:
+    // Move the pending bytes to the front of the buffer and fill the rest. Return false if nothing was read.
+    bool refill_();
+
+private:
+    std::istream& stream_;
+    std::vector<char> buffer_;
+    std::size_t begin_ = 0;
+    std::size_t end_ = 0;
+    std::size_t line_number_ = 0;
+    bool skip_overlong_tail_ = false;
+};
+
+inline bool version_line_reader::refill_()
+{
+    if (!stream_)
+        return false;
+    const std::size_t pending_size = end_ - begin_;
+    if (begin_ > 0 && pending_size > 0)
+        std::memmove(buffer_.data(), buffer_.data() + begin_, pending_size);
+    begin_ = 0;
+    end_ = pending_size;
+    stream_.read(buffer_.data() + end_, static_cast<std::streamsize>(buffer_.size() - end_));
+    const std::size_t read_size = static_cast<std::size_t>(stream_.gcount());
+    end_ += read_size;
+    return read_size > 0;
+}
+
+inline bool version_line_reader::next(version_line& line)
+{
+    for (;;)
+    {
+        const char* const data = buffer_.data();
+        if (const void* eol = std::memchr(data + begin_, '\n', end_ - begin_))
+        {
+            const std::size_t eol_pos = static_cast<const char*>(eol) - data;
+            const std::string_view text(data + begin_, eol_pos - begin_);
+            begin_ = eol_pos + 1;
+            if (skip_overlong_tail_)
+            {
+                skip_overlong_tail_ = false;
+                continue;
+            }
+            ++line_number_;
+            if (text.empty() || text == "\r")
+                continue;
+            line.line_number = line_number_;
+            private_::parse_version_line_(line, text);
+            return true;
+        }
+
+        // No complete line in the buffer.
+        const bool buffer_is_full = begin_ == 0 && end_ == buffer_.size();
+        if (!buffer_is_full && refill_())
+            continue;
+        if (begin_ == end_)
+            return false;
+
+        // Either the last line of the stream (no end of line) or a line which does not fit in the buffer. A line which
+        // exactly fills the buffer fits: its end of line (or the end of the stream) is the next byte.
+        const std::string_view text(data + begin_, end_ - begin_);
+        begin_ = end_ = 0;
+        bool is_overlong = false;
+        if (buffer_is_full)
+        {
+            const std::istream::int_type next_char = stream_.peek();
+            if (next_char == std::istream::traits_type::to_int_type('\n'))
+                stream_.get();
+            else
+                is_overlong = next_char != std::istream::traits_type::eof();
+        }
+        if (skip_overlong_tail_)
+        {
+            skip_overlong_tail_ = is_overlong;
+            continue;
+        }
+        ++line_number_;
+        line.line_number = line_number_;
+        private_::parse_version_line_(line, text);
+        if (is_overlong)
+        {
+            line.valid = false;
+            skip_overlong_tail_ = true;
+        }
+        return true;
+    }
+}
+
+} // namespace vrsn
+} // namespace arba
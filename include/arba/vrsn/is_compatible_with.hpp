@@ -23,5 +23,26 @@ inline constexpr bool is_patch_compatible_with(const Numver auto& lv, const Numv
     return lv.major() == rv.major() && lv.minor() == rv.minor() && lv.patch() == rv.patch();
 }
 
+enum class compatibility
+{
+    major,
+    minor,
+    patch
+};
+
+inline constexpr bool is_compatible_with(const Numver auto& lv, const Numver auto& rv, compatibility policy) noexcept
+{
+    switch (policy)
+    {
+    case compatibility::major:
+        return is_major_compatible_with(lv, rv);
+    case compatibility::minor:
+        return is_minor_compatible_with(lv, rv);
+    case compatibility::patch:
+        return is_patch_compatible_with(lv, rv);
+    }
+    return false;
+}
+
 } // namespace vrsn
 } // namespace arba
@@ -0,0 +1,139 @@
+#pragma once
+
+#include "binary_encoding.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <vector>
+
+inline namespace arba
+{
+namespace vrsn
+{
+
+struct negotiation_result
+{
+    numver local;  // version of the local set
+    numver remote; // version of the remote set
+    numver agreed; // the lowest of both: the newest side is compatible with it
+
+    bool operator==(const negotiation_result&) const = default;
+};
+
+namespace private_
+{
+
+// Part of a version which must be equal for two versions to be compatible with `policy`.
+[[nodiscard]] inline constexpr numver negotiation_key_(const numver& version, compatibility policy) noexcept
+{
+    switch (policy)
+    {
+    case compatibility::major:
+        return numver(version.major(), 0, 0);
+    case compatibility::minor:
+        return numver(version.major(), version.minor(), 0);
+    case compatibility::patch:
+        break;
+    }
+    return version;
+}
+
+} // namespace private_
+
+// Highest version both sides support: the greatest pair (local version, remote version) which are compatible with
+// `policy` (compatibility::patch requires equal versions), or none. Both spans must be sorted in ascending order.
+// The spans are merge-joined from their greatest versions; a run of versions without counterpart is skipped with a
+// binary search, so that large sets cost a few logarithmic steps.
+[[nodiscard]] inline constexpr std::optional<negotiation_result>
+negotiate(std::span<const numver> local_versions, std::span<const numver> remote_versions, compatibility policy)
+{
+    std::size_t local_end = local_versions.size();
+    std::size_t remote_end = remote_versions.size();
+    while (local_end > 0 && remote_end > 0)
+    {
+        const numver local_key = private_::negotiation_key_(local_versions[local_end - 1], policy);
+        const numver remote_key = private_::negotiation_key_(remote_versions[remote_end - 1], policy);
+        if (local_key == remote_key)
+        {
+            const numver& local = local_versions[local_end - 1];
+            const numver& remote = remote_versions[remote_end - 1];
+            return negotiation_result{ local, remote, std::min(local, remote) };
+        }
+        // Drop the versions whose key is greater than the greatest key of the other side.
+        auto key_is_not_greater = [policy](const numver& key)
+        {
+            return [policy, key](const numver& version)
+            { return !(key < private_::negotiation_key_(version, policy)); };
+        };
+        if (remote_key < local_key)
+            local_end = static_cast<std::size_t>(
+                std::partition_point(local_versions.begin(), local_versions.begin() + local_end,
+                                     key_is_not_greater(remote_key))
+                - local_versions.begin());
+        else
+            remote_end = static_cast<std::size_t>(
+                std::partition_point(remote_versions.begin(), remote_versions.begin() + remote_end,
+                                     key_is_not_greater(local_key))
+                - remote_versions.begin());
+    }
+    return std::nullopt;
+}
+
+// Wire form of a set of supported versions: the number of versions as a varint, then the versions in ascending
+// order, in the binary encoding of numver (one byte for small versions).
+
+[[nodiscard]] inline constexpr std::size_t encoded_version_set_size(std::span<const numver> versions) noexcept
+{
+    std::size_t size = private_::varint_size_(versions.size());
+    for (const numver& version : versions)
+        size += encoded_size(version);
+    return size;
+}
+
+// Write the sorted `versions` at the beginning of `output`. On failure (std::errc::value_too_large), the output is
+// left in an unspecified state.
+inline constexpr binary_result encode_version_set_to(std::span<std::byte> output,
+                                                     std::span<const numver> versions) noexcept
+{
+    if (output.size() < private_::varint_size_(versions.size()))
+        return { 0, std::errc::value_too_large };
+    std::size_t pos = static_cast<std::size_t>(private_::write_varint_(output.data(), versions.size()) - output.data());
+    for (const numver& version : versions)
+    {
+        const binary_result res = encode_to(output.subspan(pos), version);
+        if (!res)
+            return res;
+        pos += res.size;
+    }
+    return { pos, std::errc{} };
+}
+
+// Read a set of versions from the beginning of `input` into `versions` (replaced).
+// Errors: std::errc::invalid_argument if the input is truncated or malformed, or if the versions are not strictly
+// ascending; std::errc::result_out_of_range if a number does not fit a numver.
+inline binary_result decode_version_set_from(std::span<const std::byte> input, std::vector<numver>& versions)
+{
+    std::size_t pos = 0;
+    uint64_t count = 0;
+    if (!private_::read_varint_(input, pos, count) || count > input.size() - pos) // a version takes one byte or more
+        return { 0, std::errc::invalid_argument };
+    versions.clear();
+    versions.reserve(static_cast<std::size_t>(count));
+    for (uint64_t index = 0; index < count; ++index)
+    {
+        numver version;
+        const binary_result res = decode_from(input.subspan(pos), version);
+        if (!res)
+            return { 0, res.ec };
+        if (!versions.empty() && !(versions.back() < version))
+            return { 0, std::errc::invalid_argument };
+        versions.push_back(version);
+        pos += res.size;
+    }
+    return { pos, std::errc{} };
+}
+
+} // namespace vrsn
+} // namespace arba
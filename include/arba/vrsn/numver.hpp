@@ -3,9 +3,12 @@
 #include "_private/extract_numver.hpp"
 #include "concepts/numver.hpp"
 #include "is_compatible_with.hpp"
+#include "stats.hpp"
 
 // #include <arba/vrsn/compile_time_error.hpp>
 #include <arba/vrsn/string/string_conversion.hpp>
+#include <arba/vrsn/string/to_chars.hpp>
+#include <algorithm>
 #include <cstdint>
 #include <format>
 #include <tuple>
@@ -91,9 +94,12 @@ constexpr numver::numver(std::string_view version_str) : numver(make_instance_(v
 
 constexpr numver numver::make_instance_(std::string_view version_str)
 {
+    private_::count_stat_(stat_counter::numver_parse);
+    [[maybe_unused]] const private_::stats_timer_ timer(stat_counter::numver_parse_time);
     std::string_view major, minor, patch;
     if (!private_::extract_numver_(version_str, major, minor, patch)) [[unlikely]]
     {
+        private_::count_stat_(stat_counter::invalid_numver);
         if (std::is_constant_evaluated())
         {
             compile_time_error("'version_str' is not a valid version."
@@ -104,6 +110,34 @@ constexpr numver numver::make_instance_(std::string_view version_str)
     return numver(stoi64(major), stoi64(minor), stoi64(patch));
 }
 
+namespace private_
+{
+inline constexpr std::size_t numver_max_formatted_size_ = 20 + 1 + 10 + 1 + 10;
+}
+
+// Upper bound of the number of characters written by to_chars() for any numver.
+[[nodiscard]] inline constexpr std::size_t max_formatted_size(const numver&) noexcept
+{
+    return private_::numver_max_formatted_size_;
+}
+
+// Write "major.minor.patch" in [first, last). On failure, return { last, std::errc::value_too_large }.
+inline constexpr std::to_chars_result to_chars(char* first, char* last, const numver& version) noexcept
+{
+    const std::size_t major_digits = private_::count_digits_(version.major());
+    const std::size_t minor_digits = private_::count_digits_(version.minor());
+    const std::size_t patch_digits = private_::count_digits_(version.patch());
+    if (static_cast<std::size_t>(last - first) < major_digits + minor_digits + patch_digits + 2)
+        return { last, std::errc::value_too_large };
+
+    first = private_::write_digits_(first, version.major(), major_digits);
+    *first++ = '.';
+    first = private_::write_digits_(first, version.minor(), minor_digits);
+    *first++ = '.';
+    first = private_::write_digits_(first, version.patch(), patch_digits);
+    return { first, std::errc{} };
+}
+
 } // namespace vrsn
 } // namespace arba
 
@@ -119,6 +153,8 @@ struct std::formatter<::arba::vrsn::numver, CharT>
     template <class FormatContext>
     auto format(const ::arba::vrsn::numver& version, FormatContext& ctx) const
     {
-        return std::format_to(ctx.out(), "{}.{}.{}", version.major(), version.minor(), version.patch());
+        char buffer[::arba::vrsn::private_::numver_max_formatted_size_];
+        const std::to_chars_result res = ::arba::vrsn::to_chars(std::begin(buffer), std::end(buffer), version);
+        return std::copy(std::begin(buffer), res.ptr, ctx.out());
     }
 };
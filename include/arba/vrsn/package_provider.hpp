@@ -0,0 +1,78 @@
+#pragma once
+
+#include "version_range.hpp"
+
+#include <functional>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+inline namespace arba
+{
+namespace vrsn
+{
+
+struct dependency
+{
+    std::string package;
+    version_range range;
+};
+
+// Source of the packages known by the resolver.
+class package_provider
+{
+public:
+    virtual ~package_provider() = default;
+
+    // Available versions of `package` (in any order), or an empty list if the package is unknown.
+    [[nodiscard]] virtual std::vector<semver> versions(std::string_view package) const = 0;
+    // Dependencies of `version` of `package`.
+    [[nodiscard]] virtual std::vector<dependency> dependencies(std::string_view package,
+                                                               const semver& version) const = 0;
+};
+
+// package_provider storing the package graph in memory.
+class memory_package_provider : public package_provider
+{
+public:
+    // Add (or replace) `version` of `package`.
+    inline void add(std::string_view package, const semver& version, std::vector<dependency> dependencies = {})
+    {
+        auto iter = packages_.find(package);
+        if (iter == packages_.end())
+            iter = packages_.emplace(std::string(package), versions_type()).first;
+        iter->second.insert_or_assign(version, std::move(dependencies));
+    }
+
+    [[nodiscard]] inline std::vector<semver> versions(std::string_view package) const override
+    {
+        std::vector<semver> package_versions;
+        if (auto iter = packages_.find(package); iter != packages_.end())
+        {
+            package_versions.reserve(iter->second.size());
+            for (const auto& entry : iter->second)
+                package_versions.push_back(entry.first);
+        }
+        return package_versions;
+    }
+
+    [[nodiscard]] inline std::vector<dependency> dependencies(std::string_view package,
+                                                              const semver& version) const override
+    {
+        if (auto iter = packages_.find(package); iter != packages_.end())
+        {
+            if (auto version_iter = iter->second.find(version); version_iter != iter->second.end())
+                return version_iter->second;
+        }
+        return {};
+    }
+
+private:
+    using versions_type = std::map<semver, std::vector<dependency>>;
+
+    std::map<std::string, versions_type, std::less<>> packages_;
+};
+
+} // namespace vrsn
+} // namespace arba
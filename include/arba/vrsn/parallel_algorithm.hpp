@@ -0,0 +1,171 @@
+#pragma once
+
+#include "_private/parallel_for.hpp"
+#include "concepts/numver.hpp"
+#include "is_compatible_with.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <span>
+#include <vector>
+
+inline namespace arba
+{
+namespace vrsn
+{
+
+struct parallel_options
+{
+    unsigned thread_count = 0;            // 0: std::thread::hardware_concurrency()
+    std::size_t min_chunk_size = 16 * 1024; // minimum number of elements processed by a thread
+};
+
+enum class unique_mode
+{
+    precedence, // equal precedence (build metadata is ignored)
+    identity    // equal precedence and equal build metadata
+};
+
+namespace private_
+{
+
+// Bounds of the chunks a range of `size` elements is split into: chunk i is [bounds[i], bounds[i + 1]).
+[[nodiscard]] inline std::vector<std::size_t> chunk_bounds_(std::size_t size, const parallel_options& options)
+{
+    const std::size_t min_chunk_size = std::max<std::size_t>(options.min_chunk_size, 1);
+    const std::size_t chunk_count =
+        std::max<std::size_t>(1, std::min<std::size_t>(resolve_thread_count_(options.thread_count),
+                                                       size / min_chunk_size));
+    std::vector<std::size_t> bounds(chunk_count + 1);
+    for (std::size_t i = 0; i <= chunk_count; ++i)
+        bounds[i] = size * i / chunk_count;
+    return bounds;
+}
+
+template <class VersionT>
+[[nodiscard]] inline constexpr bool are_identical_(const VersionT& lv, const VersionT& rv)
+{
+    if constexpr (requires { lv.build_metadata(); })
+        return lv == rv && lv.build_metadata() == rv.build_metadata();
+    else
+        return lv == rv;
+}
+
+} // namespace private_
+
+// Stable sort of `versions`: chunks are sorted concurrently, then merged pairwise concurrently.
+template <class VersionT, class Compare = std::less<>>
+void parallel_sort(std::span<VersionT> versions, Compare comp = Compare(), const parallel_options& options = {})
+{
+    const std::vector<std::size_t> bounds = private_::chunk_bounds_(versions.size(), options);
+    const std::size_t chunk_count = bounds.size() - 1;
+    const auto at = [&](std::size_t index) { return versions.begin() + index; };
+
+    private_::parallel_for_(chunk_count, options.thread_count, [&](std::size_t chunk)
+                            { std::stable_sort(at(bounds[chunk]), at(bounds[chunk + 1]), comp); });
+
+    for (std::size_t width = 1; width < chunk_count; width *= 2)
+    {
+        const std::size_t merge_count = (chunk_count + 2 * width - 1) / (2 * width);
+        private_::parallel_for_(merge_count, options.thread_count,
+                                [&](std::size_t merge)
+                                {
+                                    const std::size_t first = merge * 2 * width;
+                                    const std::size_t middle = std::min(first + width, chunk_count);
+                                    const std::size_t last = std::min(first + 2 * width, chunk_count);
+                                    std::inplace_merge(at(bounds[first]), at(bounds[middle]), at(bounds[last]), comp);
+                                });
+    }
+}
+
+// Remove consecutive duplicates of a sorted range, like std::unique, with chunks processed concurrently.
+// Return the new size of the range: the elements past it are left in a valid but unspecified state.
+template <class VersionT>
+std::size_t parallel_unique(std::span<VersionT> versions, unique_mode mode = unique_mode::precedence,
+                            const parallel_options& options = {})
+{
+    const auto are_equal = [mode](const VersionT& lv, const VersionT& rv)
+    { return mode == unique_mode::identity ? private_::are_identical_(lv, rv) : lv == rv; };
+
+    const std::vector<std::size_t> bounds = private_::chunk_bounds_(versions.size(), options);
+    const std::size_t chunk_count = bounds.size() - 1;
+
+    // The first element of a chunk is dropped if it equals the last element of the previous chunk. This must be
+    // known before the chunks are modified.
+    std::vector<char> drop_first(chunk_count, false);
+    for (std::size_t chunk = 1; chunk < chunk_count; ++chunk)
+    {
+        const std::size_t first = bounds[chunk];
+        drop_first[chunk] = first < bounds[chunk + 1] && are_equal(versions[first - 1], versions[first]);
+    }
+
+    std::vector<std::size_t> kept_begins(chunk_count), kept_ends(chunk_count);
+    private_::parallel_for_(chunk_count, options.thread_count,
+                            [&](std::size_t chunk)
+                            {
+                                const auto first = versions.begin() + bounds[chunk];
+                                const auto last = versions.begin() + bounds[chunk + 1];
+                                const auto new_last = std::unique(first, last, are_equal);
+                                kept_begins[chunk] = bounds[chunk] + (drop_first[chunk] && first != new_last);
+                                kept_ends[chunk] = new_last - versions.begin();
+                            });
+
+    std::size_t size = 0;
+    for (std::size_t chunk = 0; chunk < chunk_count; ++chunk)
+    {
+        if (size != kept_begins[chunk])
+            std::move(versions.begin() + kept_begins[chunk], versions.begin() + kept_ends[chunk],
+                      versions.begin() + size);
+        size += kept_ends[chunk] - kept_begins[chunk];
+    }
+    return size;
+}
+
+// Greatest element of `versions` for which `pred` is true (the first one if several are equivalent),
+// or nullptr if there is none.
+template <class VersionT, class Predicate>
+VersionT* parallel_max_if(std::span<VersionT> versions, Predicate pred, const parallel_options& options = {})
+{
+    const std::vector<std::size_t> bounds = private_::chunk_bounds_(versions.size(), options);
+    const std::size_t chunk_count = bounds.size() - 1;
+
+    std::vector<VersionT*> chunk_maxima(chunk_count, nullptr);
+    private_::parallel_for_(chunk_count, options.thread_count,
+                            [&](std::size_t chunk)
+                            {
+                                VersionT* max = nullptr;
+                                for (std::size_t i = bounds[chunk]; i < bounds[chunk + 1]; ++i)
+                                {
+                                    VersionT& version = versions[i];
+                                    if ((!max || *max < version) && pred(version))
+                                        max = &version;
+                                }
+                                chunk_maxima[chunk] = max;
+                            });
+
+    VersionT* max = nullptr;
+    for (VersionT* chunk_max : chunk_maxima)
+    {
+        if (chunk_max && (!max || *max < *chunk_max))
+            max = chunk_max;
+    }
+    return max;
+}
+
+template <class VersionT>
+VersionT* parallel_max(std::span<VersionT> versions, const parallel_options& options = {})
+{
+    return parallel_max_if(versions, [](const VersionT&) { return true; }, options);
+}
+
+// Greatest element of `versions` compatible with `required` according to `policy`, or nullptr if there is none.
+template <class VersionT>
+VersionT* parallel_max_compatible(std::span<VersionT> versions, const Numver auto& required,
+                                  compatibility policy = compatibility::major, const parallel_options& options = {})
+{
+    return parallel_max_if(
+        versions, [&](const VersionT& version) { return is_compatible_with(version, required, policy); }, options);
+}
+
+} // namespace vrsn
+} // namespace arba
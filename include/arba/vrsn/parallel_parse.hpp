@@ -0,0 +1,101 @@
+#pragma once
+
+#include "_private/parallel_for.hpp"
+#include "io/version_lines.hpp"
+
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+inline namespace arba
+{
+namespace vrsn
+{
+
+struct parallel_parse_options
+{
+    char delimiter = '\n';
+    unsigned thread_count = 0;              // 0: std::thread::hardware_concurrency()
+    std::size_t chunk_size = 1024 * 1024;   // approximate size in bytes of the chunks parsed by the threads
+};
+
+struct parse_error
+{
+    std::size_t line_number = 0; // 1-based
+    std::string_view text;       // refers to the parsed text
+};
+
+template <class VersionT>
+struct parallel_parse_result
+{
+    std::vector<VersionT> versions; // valid versions, in input order
+    std::vector<parse_error> errors; // invalid lines, in input order
+};
+
+// Parse a text made of versions separated by `options.delimiter` (empty records are skipped).
+// The text is split into chunks at delimiter boundaries, and the chunks are parsed concurrently.
+// VersionT is semver, or semver_view to get versions referring to `text` without any string allocation.
+template <class VersionT = semver>
+    requires std::is_same_v<VersionT, semver> || std::is_same_v<VersionT, semver_view>
+parallel_parse_result<VersionT> parallel_parse(std::string_view text, const parallel_parse_options& options = {})
+{
+    const std::size_t chunk_size = std::max<std::size_t>(options.chunk_size, 1);
+    std::vector<std::string_view> chunks;
+    chunks.reserve(text.size() / chunk_size + 1);
+    for (std::string_view remaining = text; !remaining.empty();)
+    {
+        std::size_t chunk_end = remaining.size();
+        if (chunk_size < remaining.size())
+        {
+            const void* delimiter = std::memchr(remaining.data() + chunk_size - 1, options.delimiter,
+                                                remaining.size() - chunk_size + 1);
+            if (delimiter)
+                chunk_end = static_cast<const char*>(delimiter) - remaining.data() + 1;
+        }
+        chunks.push_back(remaining.substr(0, chunk_end));
+        remaining.remove_prefix(chunk_end);
+    }
+
+    std::vector<parallel_parse_result<VersionT>> chunk_results(chunks.size());
+    std::vector<std::size_t> chunk_line_counts(chunks.size());
+    private_::parallel_for_(chunks.size(), options.thread_count,
+                            [&](std::size_t index)
+                            {
+                                parallel_parse_result<VersionT>& result = chunk_results[index];
+                                version_lines lines(chunks[index], options.delimiter);
+                                for (const version_line& line : lines)
+                                {
+                                    if (!line.valid)
+                                        result.errors.push_back({ line.line_number, line.text });
+                                    else if constexpr (std::is_same_v<VersionT, semver>)
+                                        result.versions.push_back(line.version.to_semver());
+                                    else
+                                        result.versions.push_back(line.version);
+                                }
+                                chunk_line_counts[index] = lines.line_count();
+                            });
+
+    parallel_parse_result<VersionT> result;
+    std::size_t version_count = 0;
+    for (const auto& chunk_result : chunk_results)
+        version_count += chunk_result.versions.size();
+    result.versions.reserve(version_count);
+
+    std::size_t line_offset = 0;
+    for (std::size_t index = 0; index < chunks.size(); ++index)
+    {
+        auto& chunk_result = chunk_results[index];
+        std::move(chunk_result.versions.begin(), chunk_result.versions.end(), std::back_inserter(result.versions));
+        for (parse_error& error : chunk_result.errors)
+        {
+            error.line_number += line_offset;
+            result.errors.push_back(error);
+        }
+        line_offset += chunk_line_counts[index];
+    }
+    return result;
+}
+
+} // namespace vrsn
+} // namespace arba
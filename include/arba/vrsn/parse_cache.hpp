@@ -0,0 +1,213 @@
+#pragma once
+
+#include "semver_view.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+inline namespace arba
+{
+namespace vrsn
+{
+
+// Bounded cache of parsed versions, for servers parsing the same version strings again and again.
+// The cache is split into shards, each one protected by its own mutex and evicting its least recently used entries,
+// so that threads parsing different strings seldom wait for each other. The hash of a string is computed once, and
+// used both to select a shard and to probe it.
+// VersionT is semver or numver. Strings are accepted like the constructors of these classes do.
+template <class VersionT = semver>
+    requires std::is_same_v<VersionT, semver> || std::is_same_v<VersionT, numver>
+class parse_cache
+{
+public:
+    using value_type = std::shared_ptr<const VersionT>;
+
+    explicit parse_cache(std::size_t capacity = 4096, std::size_t shard_count = 16);
+    parse_cache(const parse_cache&) = delete;
+    parse_cache& operator=(const parse_cache&) = delete;
+
+    // Parsed version of `version_str`, or nullptr if `version_str` is not a valid version (invalid strings are cached
+    // too).
+    [[nodiscard]] value_type parse(std::string_view version_str);
+
+    [[nodiscard]] inline std::size_t capacity() const noexcept { return shard_capacity_ * shards_.size(); }
+    [[nodiscard]] inline std::size_t shard_count() const noexcept { return shards_.size(); }
+    [[nodiscard]] std::size_t size() const;
+    [[nodiscard]] uint64_t hit_count() const noexcept;
+    [[nodiscard]] uint64_t miss_count() const noexcept;
+    void clear();
+
+private:
+    struct key_
+    {
+        std::size_t hash;
+        std::string str;
+    };
+
+    struct key_view_
+    {
+        std::size_t hash;
+        std::string_view str;
+    };
+
+    struct key_hash_
+    {
+        using is_transparent = void;
+        inline std::size_t operator()(const key_& key) const noexcept { return key.hash; }
+        inline std::size_t operator()(const key_view_& key) const noexcept { return key.hash; }
+    };
+
+    struct key_equal_
+    {
+        using is_transparent = void;
+        template <class LeftKey, class RightKey>
+        inline bool operator()(const LeftKey& lkey, const RightKey& rkey) const noexcept
+        {
+            return lkey.hash == rkey.hash && std::string_view(lkey.str) == std::string_view(rkey.str);
+        }
+    };
+
+    struct entry_
+    {
+        value_type version;
+        typename std::list<const key_*>::iterator position;
+    };
+
+    struct alignas(64) shard_
+    {
+        mutable std::mutex mutex;
+        std::unordered_map<key_, entry_, key_hash_, key_equal_> entries;
+        std::list<const key_*> recency; // most recently used first
+        std::atomic<uint64_t> hit_count{ 0 };
+        std::atomic<uint64_t> miss_count{ 0 };
+    };
+
+    static value_type parse_(std::string_view version_str);
+
+private:
+    std::size_t shard_capacity_;
+    std::vector<shard_> shards_;
+};
+
+template <class VersionT>
+    requires std::is_same_v<VersionT, semver> || std::is_same_v<VersionT, numver>
+parse_cache<VersionT>::parse_cache(std::size_t capacity, std::size_t shard_count)
+    : shard_capacity_(shard_count == 0 ? 0 : (capacity + shard_count - 1) / shard_count), shards_(shard_count)
+{
+    if (capacity == 0 || shard_count == 0)
+        throw std::invalid_argument("The capacity and the shard count of a cache must not be zero.");
+}
+
+template <class VersionT>
+    requires std::is_same_v<VersionT, semver> || std::is_same_v<VersionT, numver>
+typename parse_cache<VersionT>::value_type parse_cache<VersionT>::parse_(std::string_view version_str)
+{
+    if constexpr (std::is_same_v<VersionT, semver>)
+    {
+        semver_view version;
+        if (!private_::extract_semver_view_(version_str, version))
+            return nullptr;
+        return std::make_shared<const semver>(version.to_semver());
+    }
+    else
+    {
+        std::string_view major, minor, patch;
+        if (!private_::extract_numver_(version_str, major, minor, patch))
+            return nullptr;
+        return std::make_shared<const numver>(stoi64(major), static_cast<uint32_t>(stoi64(minor)),
+                                              static_cast<uint32_t>(stoi64(patch)));
+    }
+}
+
+template <class VersionT>
+    requires std::is_same_v<VersionT, semver> || std::is_same_v<VersionT, numver>
+typename parse_cache<VersionT>::value_type parse_cache<VersionT>::parse(std::string_view version_str)
+{
+    const key_view_ key{ std::hash<std::string_view>()(version_str), version_str };
+    // The low bits of the hash select the bucket in the shard: use other bits to select the shard.
+    shard_& shard = shards_[(key.hash >> 24) % shards_.size()];
+    {
+        std::scoped_lock lock(shard.mutex);
+        if (auto iter = shard.entries.find(key); iter != shard.entries.end())
+        {
+            shard.recency.splice(shard.recency.begin(), shard.recency, iter->second.position);
+            shard.hit_count.fetch_add(1, std::memory_order_relaxed);
+            return iter->second.version;
+        }
+    }
+
+    // Parse without holding the lock. Another thread may insert the same string meanwhile: keep its entry.
+    shard.miss_count.fetch_add(1, std::memory_order_relaxed);
+    value_type version = parse_(version_str);
+    std::scoped_lock lock(shard.mutex);
+    auto [iter, inserted] =
+        shard.entries.try_emplace(key_{ key.hash, std::string(version_str) }, entry_{ version, {} });
+    if (!inserted)
+        return iter->second.version;
+    shard.recency.push_front(&iter->first);
+    iter->second.position = shard.recency.begin();
+    if (shard.entries.size() > shard_capacity_)
+    {
+        shard.entries.erase(shard.entries.find(*shard.recency.back()));
+        shard.recency.pop_back();
+    }
+    return version;
+}
+
+template <class VersionT>
+    requires std::is_same_v<VersionT, semver> || std::is_same_v<VersionT, numver>
+std::size_t parse_cache<VersionT>::size() const
+{
+    std::size_t size = 0;
+    for (const shard_& shard : shards_)
+    {
+        std::scoped_lock lock(shard.mutex);
+        size += shard.entries.size();
+    }
+    return size;
+}
+
+template <class VersionT>
+    requires std::is_same_v<VersionT, semver> || std::is_same_v<VersionT, numver>
+uint64_t parse_cache<VersionT>::hit_count() const noexcept
+{
+    uint64_t count = 0;
+    for (const shard_& shard : shards_)
+        count += shard.hit_count.load(std::memory_order_relaxed);
+    return count;
+}
+
+template <class VersionT>
+    requires std::is_same_v<VersionT, semver> || std::is_same_v<VersionT, numver>
+uint64_t parse_cache<VersionT>::miss_count() const noexcept
+{
+    uint64_t count = 0;
+    for (const shard_& shard : shards_)
+        count += shard.miss_count.load(std::memory_order_relaxed);
+    return count;
+}
+
+template <class VersionT>
+    requires std::is_same_v<VersionT, semver> || std::is_same_v<VersionT, numver>
+void parse_cache<VersionT>::clear()
+{
+    for (shard_& shard : shards_)
+    {
+        std::scoped_lock lock(shard.mutex);
+        shard.entries.clear();
+        shard.recency.clear();
+    }
+}
+
+} // namespace vrsn
+} // namespace arba
@@ -0,0 +1,233 @@
+#pragma once
+
+#include "io/mapped_file.hpp"
+#include "semver_view.hpp"
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+
+#if __has_include(<elf.h>)
+#include <elf.h>
+#define ARBA_VRSN_HAS_ELF 1
+#else
+#define ARBA_VRSN_HAS_ELF 0
+#endif
+#if __has_include(<dlfcn.h>)
+#include <dlfcn.h>
+#define ARBA_VRSN_HAS_DLFCN 1
+#else
+#define ARBA_VRSN_HAS_DLFCN 0
+#endif
+
+#if defined(_WIN32)
+#define ARBA_VRSN_SYMBOL_EXPORT __declspec(dllexport)
+#else
+#define ARBA_VRSN_SYMBOL_EXPORT __attribute__((visibility("default")))
+#endif
+
+#define ARBA_VRSN_STRINGIFY_IMPL_(text) #text
+#define ARBA_VRSN_STRINGIFY_(text) ARBA_VRSN_STRINGIFY_IMPL_(text)
+
+// Name of the C symbol holding the version record of a shared library.
+#define ARBA_VRSN_VERSION_RECORD_SYMBOL arba_vrsn_version_record
+
+// Export the version record of the shared library being built. `version` is a semantic version (string, semver or
+// semver_view), whose build metadata is ignored. The record is constant-initialized: reading it requires neither
+// constructing a semver nor running the static initializers of the library.
+#define ARBA_VRSN_EXPORT_VERSION_RECORD(version)                                                                     \
+    extern "C" ARBA_VRSN_SYMBOL_EXPORT constinit const ::arba::vrsn::version_record ARBA_VRSN_VERSION_RECORD_SYMBOL = \
+        ::arba::vrsn::make_version_record(version)
+
+inline namespace arba
+{
+namespace vrsn
+{
+
+// Version of a shared library, with a fixed layout (no padding, no pointer, no relocation), so that it can be read
+// directly from the file of the library.
+struct version_record
+{
+    static constexpr uint32_t expected_magic = 0x4e535256; // "VRSN" in little-endian order
+    static constexpr uint32_t current_layout = 1;
+    static constexpr std::size_t max_pre_release_size = 47;
+
+    uint32_t magic;
+    uint32_t layout;
+    uint64_t core_major;
+    uint32_t core_minor;
+    uint32_t core_patch;
+    char pre_release_chars[max_pre_release_size + 1]; // null-terminated
+
+    inline constexpr uint64_t major() const noexcept { return core_major; }
+    inline constexpr uint32_t minor() const noexcept { return core_minor; }
+    inline constexpr uint32_t patch() const noexcept { return core_patch; }
+    inline constexpr std::string_view pre_release() const noexcept
+    {
+        std::size_t size = 0;
+        while (size < max_pre_release_size && pre_release_chars[size] != '\0')
+            ++size;
+        return std::string_view(pre_release_chars, size);
+    }
+    inline constexpr semver_view to_semver_view() const noexcept
+    {
+        return semver_view(numver(core_major, core_minor, core_patch), pre_release());
+    }
+
+    inline constexpr bool is_valid() const noexcept
+    {
+        return magic == expected_magic && layout == current_layout
+               && pre_release_chars[max_pre_release_size] == '\0';
+    }
+};
+
+static_assert(sizeof(version_record) == 72 && alignof(version_record) == 8);
+
+inline constexpr version_record make_version_record(const semver_view& version)
+{
+    if (version.pre_release().size() > version_record::max_pre_release_size) [[unlikely]]
+        throw std::invalid_argument("The pre-release of a version record is limited to 47 characters.");
+    version_record record{ version_record::expected_magic, version_record::current_layout, version.major(),
+                           version.minor(), version.patch(), {} };
+    for (std::size_t index = 0; index < version.pre_release().size(); ++index)
+        record.pre_release_chars[index] = version.pre_release()[index];
+    return record;
+}
+
+inline constexpr version_record make_version_record(std::string_view version)
+{
+    return make_version_record(semver_view(version));
+}
+
+inline constexpr version_record make_version_record(const semver& version)
+{
+    return make_version_record(semver_view(version));
+}
+
+// True if a plugin built against the version `plugin` can be used by a host providing the version `host`: the host
+// must be major-compatible with the plugin version. A pre-release plugin version requires the exact same version.
+[[nodiscard]] inline constexpr bool is_plugin_compatible(const version_record& plugin, const Numver auto& host) noexcept
+{
+    if (!is_major_compatible_with(host, plugin))
+        return false;
+    if (plugin.pre_release().empty())
+        return true;
+    if constexpr (requires { host.pre_release(); })
+        return numver(host) == numver(plugin) && host.pre_release() == plugin.pre_release();
+    else
+        return false;
+}
+
+#if ARBA_VRSN_HAS_ELF
+
+namespace private_
+{
+
+template <class T>
+[[nodiscard]] inline bool read_pod_(std::span<const std::byte> bytes, uint64_t offset, T& value) noexcept
+{
+    if (offset > bytes.size() || bytes.size() - offset < sizeof(T))
+        return false;
+    std::memcpy(&value, bytes.data() + offset, sizeof(T));
+    return true;
+}
+
+// Contents of the dynamic symbol `symbol` of the ELF file `bytes` (of the native class and byte order).
+template <class Ehdr, class Shdr, class Sym>
+[[nodiscard]] inline std::optional<std::span<const std::byte>> find_elf_symbol_(std::span<const std::byte> bytes,
+                                                                              std::string_view symbol) noexcept
+{
+    Ehdr header;
+    if (!read_pod_(bytes, 0, header) || header.e_shentsize != sizeof(Shdr))
+        return std::nullopt;
+    auto section = [&](uint64_t index) -> std::optional<Shdr>
+    {
+        Shdr section_header;
+        if (index >= header.e_shnum || !read_pod_(bytes, header.e_shoff + index * sizeof(Shdr), section_header))
+            return std::nullopt;
+        return section_header;
+    };
+
+    for (uint64_t index = 0; index < header.e_shnum; ++index)
+    {
+        const std::optional<Shdr> symbols = section(index);
+        if (!symbols || symbols->sh_type != SHT_DYNSYM)
+            continue;
+        const std::optional<Shdr> names = section(symbols->sh_link);
+        if (!names)
+            return std::nullopt;
+        for (uint64_t offset = 0; offset + sizeof(Sym) <= symbols->sh_size; offset += sizeof(Sym))
+        {
+            Sym entry;
+            if (!read_pod_(bytes, symbols->sh_offset + offset, entry))
+                return std::nullopt;
+            const uint64_t name_offset = names->sh_offset + entry.st_name;
+            if (entry.st_name >= names->sh_size || name_offset + symbol.size() >= bytes.size()
+                || std::memcmp(bytes.data() + name_offset, symbol.data(), symbol.size()) != 0
+                || bytes[name_offset + symbol.size()] != std::byte(0))
+                continue;
+            const std::optional<Shdr> data = section(entry.st_shndx);
+            if (!data || data->sh_type == SHT_NOBITS || entry.st_value < data->sh_addr
+                || entry.st_value - data->sh_addr + entry.st_size > data->sh_size)
+                return std::nullopt;
+            const uint64_t data_offset = data->sh_offset + (entry.st_value - data->sh_addr);
+            if (data_offset > bytes.size() || bytes.size() - data_offset < entry.st_size)
+                return std::nullopt;
+            return bytes.subspan(data_offset, entry.st_size);
+        }
+    }
+    return std::nullopt;
+}
+
+} // namespace private_
+
+// Version record of the shared library `path`, read from its dynamic symbol table without loading the library (its
+// static initializers are not run), or none if the library exports no valid record.
+// Only ELF files of the native class and byte order are supported.
+[[nodiscard]] inline std::optional<version_record> read_version_record(const std::filesystem::path& path)
+{
+    const mapped_file file(path);
+    const std::span<const std::byte> bytes = file.bytes();
+    if (bytes.size() < EI_NIDENT || std::memcmp(bytes.data(), ELFMAG, SELFMAG) != 0)
+        return std::nullopt;
+    constexpr unsigned char native_class = sizeof(void*) == 8 ? ELFCLASS64 : ELFCLASS32;
+    constexpr unsigned char native_data = std::endian::native == std::endian::little ? ELFDATA2LSB : ELFDATA2MSB;
+    if (std::to_integer<unsigned char>(bytes[EI_CLASS]) != native_class
+        || std::to_integer<unsigned char>(bytes[EI_DATA]) != native_data)
+        return std::nullopt;
+
+    constexpr std::string_view symbol = ARBA_VRSN_STRINGIFY_(ARBA_VRSN_VERSION_RECORD_SYMBOL);
+    std::optional<std::span<const std::byte>> contents;
+    if constexpr (native_class == ELFCLASS64)
+        contents = private_::find_elf_symbol_<Elf64_Ehdr, Elf64_Shdr, Elf64_Sym>(bytes, symbol);
+    else
+        contents = private_::find_elf_symbol_<Elf32_Ehdr, Elf32_Shdr, Elf32_Sym>(bytes, symbol);
+    version_record record;
+    if (!contents || contents->size() != sizeof(version_record) || !private_::read_pod_(*contents, 0, record)
+        || !record.is_valid())
+        return std::nullopt;
+    return record;
+}
+
+#endif
+
+#if ARBA_VRSN_HAS_DLFCN
+
+// Version record of a library loaded with dlopen(), or nullptr if it exports no valid record.
+[[nodiscard]] inline const version_record* find_version_record(void* library_handle) noexcept
+{
+    const auto* record = static_cast<const version_record*>(
+        ::dlsym(library_handle, ARBA_VRSN_STRINGIFY_(ARBA_VRSN_VERSION_RECORD_SYMBOL)));
+    return record && record->is_valid() ? record : nullptr;
+}
+
+#endif
+
+} // namespace vrsn
+} // namespace arba
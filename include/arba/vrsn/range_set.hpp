@@ -0,0 +1,244 @@
+#pragma once
+
+#include "version_range.hpp"
+
+#include <algorithm>
+#include <initializer_list>
+#include <limits>
+#include <optional>
+#include <string>
+#include <vector>
+
+inline namespace arba
+{
+namespace vrsn
+{
+namespace private_
+{
+
+// The version immediately following `version` in precedence order, or none for the greatest version.
+// Nothing sorts between 1.2.3 and 1.2.4-0, or between 1.2.3-rc and 1.2.3-rc.0.
+[[nodiscard]] inline std::optional<semver> next_version_(const semver& version)
+{
+    if (!version.pre_release().empty())
+        return semver(version.core(), std::string(version.pre_release()) + ".0");
+    if (version.patch() != std::numeric_limits<uint32_t>::max())
+        return semver(numver(version.major(), version.minor(), version.patch() + 1), "0");
+    if (version.minor() != std::numeric_limits<uint32_t>::max())
+        return semver(numver(version.major(), version.minor() + 1, 0), "0");
+    if (version.major() != std::numeric_limits<uint64_t>::max())
+        return semver(numver(version.major() + 1, 0, 0), "0");
+    return std::nullopt;
+}
+
+// Nothing precedes 0.0.0-0: an interval ending at it (excluded) is empty.
+[[nodiscard]] inline bool is_lowest_version_(const semver& version)
+{
+    return version == semver(0, 0, 0, "0");
+}
+
+// Missing lower bounds stand for -infinity, missing upper bounds for +infinity.
+[[nodiscard]] inline bool lower_bound_less_(const std::optional<semver>& lv, const std::optional<semver>& rv)
+{
+    return lv ? (rv && *lv < *rv) : bool(rv);
+}
+
+[[nodiscard]] inline bool upper_bound_less_(const std::optional<semver>& lv, const std::optional<semver>& rv)
+{
+    return rv ? (lv && *lv < *rv) : bool(lv);
+}
+
+// True if an interval ending at `upper` (excluded) ends before an interval beginning at `lower` begins, or touches it.
+[[nodiscard]] inline bool ends_before_(const std::optional<semver>& upper, const std::optional<semver>& lower)
+{
+    return upper && lower && *upper <= *lower;
+}
+
+} // namespace private_
+
+// Set of versions, stored as sorted, disjoint and non-adjacent intervals. Intervals are kept in the canonical form
+// [lower, upper), where a missing bound means the interval is unbounded on that side: "<=1.2.3" is stored as
+// "<1.2.4-0" and ">1.2.3" as ">=1.2.4-0". Two equal sets thus have the same intervals.
+// Set operations are linear in the number of intervals.
+class range_set
+{
+public:
+    // Empty set.
+    range_set() = default;
+    explicit range_set(const version_range& range);
+    range_set(std::initializer_list<version_range> ranges);
+
+    [[nodiscard]] inline static range_set any() { return range_set(version_range()); }
+    [[nodiscard]] inline static range_set compatible_with(const Numver auto& version, compatibility policy)
+    {
+        return range_set(version_range::compatible_with(version, policy));
+    }
+
+    [[nodiscard]] inline const std::vector<version_range>& intervals() const noexcept { return intervals_; }
+    [[nodiscard]] inline bool is_empty() const noexcept { return intervals_.empty(); }
+    [[nodiscard]] inline bool is_any() const noexcept { return intervals_.size() == 1 && intervals_.front().is_any(); }
+    [[nodiscard]] bool contains(const semver& version) const;
+
+    [[nodiscard]] range_set intersect(const range_set& other) const;
+    [[nodiscard]] range_set unite(const range_set& other) const;
+    [[nodiscard]] range_set complement() const;
+    [[nodiscard]] inline range_set difference(const range_set& other) const
+    {
+        return intersect(other.complement());
+    }
+    // True if every version of `other` is in this set.
+    [[nodiscard]] bool subsumes(const range_set& other) const;
+
+    // Intervals joined by " || ", or "<empty>".
+    [[nodiscard]] std::string to_string() const;
+
+    bool operator==(const range_set&) const = default;
+
+private:
+    // Append [lower, upper), merging it with the last interval if they overlap or touch. Intervals must be appended by
+    // ascending lower bound.
+    void append_(std::optional<semver> lower, std::optional<semver> upper);
+
+private:
+    std::vector<version_range> intervals_;
+};
+
+inline range_set::range_set(const version_range& range)
+{
+    std::optional<semver> lower;
+    if (range.lower())
+    {
+        lower = semver(range.lower()->core(), range.lower()->pre_release());
+        if (!range.lower_inclusive())
+        {
+            lower = private_::next_version_(*lower);
+            if (!lower) // nothing is greater than the greatest version
+                return;
+        }
+        if (private_::is_lowest_version_(*lower))
+            lower.reset();
+    }
+    std::optional<semver> upper;
+    if (range.upper())
+    {
+        upper = semver(range.upper()->core(), range.upper()->pre_release());
+        if (range.upper_inclusive())
+            upper = private_::next_version_(*upper);
+        else if (private_::is_lowest_version_(*upper))
+            return;
+    }
+    if (lower && upper && *upper <= *lower)
+        return;
+    append_(std::move(lower), std::move(upper));
+}
+
+inline range_set::range_set(std::initializer_list<version_range> ranges)
+{
+    for (const version_range& range : ranges)
+        *this = unite(range_set(range));
+}
+
+inline bool range_set::contains(const semver& version) const
+{
+    // First interval whose upper bound is greater than `version`.
+    const auto iter = std::partition_point(intervals_.begin(), intervals_.end(), [&](const version_range& interval)
+                                           { return interval.upper() && *interval.upper() <= version; });
+    return iter != intervals_.end() && iter->contains(version);
+}
+
+inline void range_set::append_(std::optional<semver> lower, std::optional<semver> upper)
+{
+    if (!intervals_.empty()
+        && !(intervals_.back().upper() && lower && *intervals_.back().upper() < *lower))
+    {
+        version_range& last = intervals_.back();
+        if (private_::upper_bound_less_(last.upper(), upper))
+            last = version_range(last.lower(), true, std::move(upper), false);
+        return;
+    }
+    intervals_.emplace_back(std::move(lower), true, std::move(upper), false);
+}
+
+inline range_set range_set::intersect(const range_set& other) const
+{
+    range_set result;
+    auto liter = intervals_.begin();
+    auto riter = other.intervals_.begin();
+    while (liter != intervals_.end() && riter != other.intervals_.end())
+    {
+        const std::optional<semver>& lower =
+            private_::lower_bound_less_(liter->lower(), riter->lower()) ? riter->lower() : liter->lower();
+        const bool left_ends_first = private_::upper_bound_less_(liter->upper(), riter->upper());
+        const std::optional<semver>& upper = left_ends_first ? liter->upper() : riter->upper();
+        if (!upper || (lower ? *lower < *upper : !private_::is_lowest_version_(*upper)))
+            result.intervals_.emplace_back(lower, true, upper, false);
+        if (left_ends_first)
+            ++liter;
+        else
+            ++riter;
+    }
+    return result;
+}
+
+inline range_set range_set::unite(const range_set& other) const
+{
+    range_set result;
+    auto liter = intervals_.begin();
+    auto riter = other.intervals_.begin();
+    while (liter != intervals_.end() || riter != other.intervals_.end())
+    {
+        const bool take_left = riter == other.intervals_.end()
+                               || (liter != intervals_.end()
+                                   && !private_::lower_bound_less_(riter->lower(), liter->lower()));
+        const version_range& interval = take_left ? *liter++ : *riter++;
+        result.append_(interval.lower(), interval.upper());
+    }
+    return result;
+}
+
+inline range_set range_set::complement() const
+{
+    range_set result;
+    std::optional<semver> lower;
+    for (const version_range& interval : intervals_)
+    {
+        if (interval.lower() && (lower || !private_::is_lowest_version_(*interval.lower())))
+            result.intervals_.emplace_back(lower, true, interval.lower(), false);
+        if (!interval.upper())
+            return result;
+        lower = interval.upper();
+    }
+    result.intervals_.emplace_back(std::move(lower), true, std::nullopt, false);
+    return result;
+}
+
+inline bool range_set::subsumes(const range_set& other) const
+{
+    auto iter = intervals_.begin();
+    for (const version_range& interval : other.intervals_)
+    {
+        while (iter != intervals_.end() && private_::ends_before_(iter->upper(), interval.lower()))
+            ++iter;
+        if (iter == intervals_.end() || private_::lower_bound_less_(interval.lower(), iter->lower())
+            || private_::upper_bound_less_(iter->upper(), interval.upper()))
+            return false;
+    }
+    return true;
+}
+
+inline std::string range_set::to_string() const
+{
+    if (intervals_.empty())
+        return "<empty>";
+    std::string str;
+    for (const version_range& interval : intervals_)
+    {
+        if (!str.empty())
+            str += " || ";
+        str += interval.to_string();
+    }
+    return str;
+}
+
+} // namespace vrsn
+} // namespace arba
@@ -0,0 +1,641 @@
+#pragma once
+
+#include "package_provider.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <format>
+#include <map>
+#include <optional>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+inline namespace arba
+{
+namespace vrsn
+{
+
+// Thrown by resolve() when there is no solution. what() explains why, as a numbered list of derivations.
+class resolution_error : public std::runtime_error
+{
+public:
+    using std::runtime_error::runtime_error;
+};
+
+// Selected version of each package.
+using resolution = std::map<std::string, semver, std::less<>>;
+
+namespace private_
+{
+
+// Subset of the available versions of a package: bit i stands for the i-th lowest available version.
+class version_bitset_
+{
+public:
+    version_bitset_() = default;
+    inline explicit version_bitset_(std::size_t size) : size_(size), words_((size + 63) / 64, 0) {}
+
+    inline std::size_t size() const noexcept { return size_; }
+    inline bool test(std::size_t index) const noexcept { return (words_[index / 64] >> (index % 64)) & 1; }
+    inline void set(std::size_t index) noexcept { words_[index / 64] |= uint64_t(1) << (index % 64); }
+
+    inline bool none() const noexcept
+    {
+        return std::all_of(words_.begin(), words_.end(), [](uint64_t word) { return word == 0; });
+    }
+    inline std::size_t count() const noexcept
+    {
+        std::size_t count = 0;
+        for (uint64_t word : words_)
+            count += std::popcount(word);
+        return count;
+    }
+    // Index of the highest set bit. The bitset must not be empty.
+    inline std::size_t highest() const noexcept
+    {
+        std::size_t word_index = words_.size();
+        while (words_[--word_index] == 0)
+        {
+        }
+        return word_index * 64 + 63 - std::countl_zero(words_[word_index]);
+    }
+
+    inline version_bitset_& operator&=(const version_bitset_& other) noexcept
+    {
+        for (std::size_t i = 0; i < words_.size(); ++i)
+            words_[i] &= other.words_[i];
+        return *this;
+    }
+    inline version_bitset_& operator|=(const version_bitset_& other) noexcept
+    {
+        for (std::size_t i = 0; i < words_.size(); ++i)
+            words_[i] |= other.words_[i];
+        return *this;
+    }
+    inline version_bitset_& subtract(const version_bitset_& other) noexcept
+    {
+        for (std::size_t i = 0; i < words_.size(); ++i)
+            words_[i] &= ~other.words_[i];
+        return *this;
+    }
+
+    bool operator==(const version_bitset_&) const = default;
+
+private:
+    std::size_t size_ = 0;
+    std::vector<uint64_t> words_;
+};
+
+// Statement about the selected version of a package:
+// - positive: the package is selected, with a version in `versions`;
+// - negative: the package is not selected, or its selected version is not in `versions`.
+struct pubgrub_term_
+{
+    std::size_t package;
+    bool positive;
+    version_bitset_ versions;
+
+    inline pubgrub_term_ negated() const { return { package, !positive, versions }; }
+    // Nothing satisfies an empty term.
+    inline bool is_empty() const noexcept { return positive && versions.none(); }
+
+    pubgrub_term_ intersection(const pubgrub_term_& other) const
+    {
+        if (positive && other.positive)
+            return { package, true, version_bitset_(versions) &= other.versions };
+        if (positive)
+            return { package, true, version_bitset_(versions).subtract(other.versions) };
+        if (other.positive)
+            return { package, true, version_bitset_(other.versions).subtract(versions) };
+        return { package, false, version_bitset_(versions) |= other.versions };
+    }
+    inline bool satisfies(const pubgrub_term_& other) const { return intersection(other.negated()).is_empty(); }
+};
+
+enum class pubgrub_relation_
+{
+    satisfied,
+    contradicted,
+    inconclusive
+};
+
+// Set of terms which cannot be all true.
+struct pubgrub_incompatibility_
+{
+    enum class kind
+    {
+        root,       // the root package must be selected
+        dependency, // a version of a package depends on a range of another package
+        derived     // derived from two incompatibilities
+    };
+
+    std::vector<pubgrub_term_> terms; // at most one term per package
+    kind cause_kind;
+    std::size_t causes[2] = { 0, 0 }; // derived
+    std::size_t dependee = 0;         // dependency
+    version_range range;              // dependency
+};
+
+// PubGrub version solving: https://github.com/dart-lang/pub/blob/master/doc/solver.md
+class pubgrub_solver_
+{
+public:
+    inline pubgrub_solver_(const package_provider& provider) : provider_(provider) {}
+
+    resolution solve(std::string_view root_package, const semver& root_version);
+
+private:
+    struct package_info
+    {
+        std::string name;
+        std::vector<semver> versions; // sorted
+        std::vector<std::size_t> incompatibilities;
+    };
+
+    struct assignment
+    {
+        pubgrub_term_ term;
+        std::size_t decision_level;
+        std::optional<std::size_t> cause; // none: decision
+    };
+
+    std::size_t package_id_(std::string_view name);
+    inline pubgrub_term_ any_term_(std::size_t package) const
+    {
+        return { package, false, version_bitset_(packages_[package].versions.size()) };
+    }
+
+    std::size_t add_incompatibility_(std::vector<pubgrub_term_> terms, pubgrub_incompatibility_::kind cause_kind,
+                                     std::size_t cause_1 = 0, std::size_t cause_2 = 0, std::size_t dependee = 0,
+                                     version_range range = {});
+    inline void index_incompatibility_(std::size_t id)
+    {
+        for (const pubgrub_term_& term : incompatibilities_[id].terms)
+            packages_[term.package].incompatibilities.push_back(id);
+    }
+    bool is_failure_(const pubgrub_incompatibility_& incompatibility) const;
+
+    pubgrub_relation_ relation_(const pubgrub_term_& term) const;
+    // Relation of the partial solution with an incompatibility. If exactly one term is inconclusive, and the others
+    // are satisfied, *almost_satisfied_term is set to its index.
+    pubgrub_relation_ relation_(const pubgrub_incompatibility_& incompatibility,
+                                std::optional<std::size_t>* almost_satisfied_term) const;
+
+    void assign_(pubgrub_term_ term, std::optional<std::size_t> cause);
+    void backtrack_(std::size_t decision_level);
+    void propagate_(std::size_t package);
+    std::size_t resolve_conflict_(std::size_t incompatibility_id);
+    std::optional<std::size_t> decide_();
+
+    std::string describe_(const pubgrub_term_& term) const;
+    std::string describe_(std::size_t incompatibility_id) const;
+    std::string explain_(std::size_t failure_id) const;
+
+private:
+    const package_provider& provider_;
+    std::size_t root_ = 0;
+    std::vector<package_info> packages_;
+    std::map<std::string, std::size_t, std::less<>> package_ids_;
+    std::vector<pubgrub_incompatibility_> incompatibilities_;
+    std::set<std::pair<std::size_t, std::size_t>> dependencies_added_;
+    // Partial solution:
+    std::vector<assignment> assignments_;
+    std::vector<pubgrub_term_> accumulated_terms_; // intersection of the assignments of each package
+    std::vector<std::optional<std::size_t>> decisions_;
+    std::size_t decision_level_ = 0;
+};
+
+inline std::size_t pubgrub_solver_::package_id_(std::string_view name)
+{
+    if (auto iter = package_ids_.find(name); iter != package_ids_.end())
+        return iter->second;
+
+    package_info info{ std::string(name), provider_.versions(name), {} };
+    std::sort(info.versions.begin(), info.versions.end());
+    info.versions.erase(std::unique(info.versions.begin(), info.versions.end()), info.versions.end());
+    const std::size_t id = packages_.size();
+    packages_.push_back(std::move(info));
+    package_ids_.emplace(name, id);
+    accumulated_terms_.push_back(any_term_(id));
+    decisions_.emplace_back();
+    return id;
+}
+
+inline std::size_t pubgrub_solver_::add_incompatibility_(std::vector<pubgrub_term_> terms,
+                                                         pubgrub_incompatibility_::kind cause_kind,
+                                                         std::size_t cause_1, std::size_t cause_2,
+                                                         std::size_t dependee, version_range range)
+{
+    // Merge the terms about the same package, and drop the terms which are always true.
+    std::vector<pubgrub_term_> merged_terms;
+    for (pubgrub_term_& term : terms)
+    {
+        auto iter = std::find_if(merged_terms.begin(), merged_terms.end(),
+                                 [&](const pubgrub_term_& merged) { return merged.package == term.package; });
+        if (iter == merged_terms.end())
+            merged_terms.push_back(std::move(term));
+        else
+            *iter = iter->intersection(term);
+    }
+    std::erase_if(merged_terms, [](const pubgrub_term_& term) { return !term.positive && term.versions.none(); });
+    incompatibilities_.push_back(
+        { std::move(merged_terms), cause_kind, { cause_1, cause_2 }, dependee, std::move(range) });
+    return incompatibilities_.size() - 1;
+}
+
+inline bool pubgrub_solver_::is_failure_(const pubgrub_incompatibility_& incompatibility) const
+{
+    return incompatibility.terms.empty()
+           || (incompatibility.terms.size() == 1 && incompatibility.terms.front().positive
+               && incompatibility.terms.front().package == root_);
+}
+
+inline pubgrub_relation_ pubgrub_solver_::relation_(const pubgrub_term_& term) const
+{
+    const pubgrub_term_& accumulated = accumulated_terms_[term.package];
+    if (accumulated.satisfies(term))
+        return pubgrub_relation_::satisfied;
+    if (accumulated.intersection(term).is_empty())
+        return pubgrub_relation_::contradicted;
+    return pubgrub_relation_::inconclusive;
+}
+
+inline pubgrub_relation_ pubgrub_solver_::relation_(const pubgrub_incompatibility_& incompatibility,
+                                                    std::optional<std::size_t>* almost_satisfied_term) const
+{
+    std::optional<std::size_t> inconclusive_term;
+    for (std::size_t i = 0; i < incompatibility.terms.size(); ++i)
+    {
+        switch (relation_(incompatibility.terms[i]))
+        {
+        case pubgrub_relation_::satisfied:
+            break;
+        case pubgrub_relation_::contradicted:
+            return pubgrub_relation_::contradicted;
+        case pubgrub_relation_::inconclusive:
+            if (inconclusive_term)
+                return pubgrub_relation_::inconclusive;
+            inconclusive_term = i;
+            break;
+        }
+    }
+    if (!inconclusive_term)
+        return pubgrub_relation_::satisfied;
+    *almost_satisfied_term = inconclusive_term;
+    return pubgrub_relation_::inconclusive;
+}
+
+inline void pubgrub_solver_::assign_(pubgrub_term_ term, std::optional<std::size_t> cause)
+{
+    const std::size_t package = term.package;
+    if (!cause)
+        decisions_[package] = term.versions.highest();
+    accumulated_terms_[package] = accumulated_terms_[package].intersection(term);
+    assignments_.push_back({ std::move(term), decision_level_, cause });
+}
+
+inline void pubgrub_solver_::backtrack_(std::size_t decision_level)
+{
+    while (!assignments_.empty() && assignments_.back().decision_level > decision_level)
+        assignments_.pop_back();
+    decision_level_ = decision_level;
+    for (std::size_t package = 0; package < packages_.size(); ++package)
+    {
+        accumulated_terms_[package] = any_term_(package);
+        decisions_[package].reset();
+    }
+    for (const assignment& assigned : assignments_)
+    {
+        const std::size_t package = assigned.term.package;
+        if (!assigned.cause)
+            decisions_[package] = assigned.term.versions.highest();
+        accumulated_terms_[package] = accumulated_terms_[package].intersection(assigned.term);
+    }
+}
+
+inline void pubgrub_solver_::propagate_(std::size_t package)
+{
+    std::vector<std::size_t> changed{ package };
+    while (!changed.empty())
+    {
+        const std::size_t changed_package = changed.back();
+        changed.pop_back();
+        // Copy: conflict resolution may add incompatibilities.
+        const std::vector<std::size_t> incompatibility_ids = packages_[changed_package].incompatibilities;
+        for (auto iter = incompatibility_ids.rbegin(); iter != incompatibility_ids.rend(); ++iter)
+        {
+            std::optional<std::size_t> almost_satisfied_term;
+            const pubgrub_relation_ relation = relation_(incompatibilities_[*iter], &almost_satisfied_term);
+            if (relation == pubgrub_relation_::satisfied)
+            {
+                const std::size_t root_cause = resolve_conflict_(*iter);
+                almost_satisfied_term.reset();
+                relation_(incompatibilities_[root_cause], &almost_satisfied_term);
+                if (!almost_satisfied_term) [[unlikely]]
+                    throw std::logic_error("The root cause of a conflict must be almost satisfied after backtracking.");
+                const pubgrub_term_& term = incompatibilities_[root_cause].terms[*almost_satisfied_term];
+                assign_(term.negated(), root_cause);
+                changed.assign(1, term.package);
+                break;
+            }
+            if (almost_satisfied_term)
+            {
+                const pubgrub_term_& term = incompatibilities_[*iter].terms[*almost_satisfied_term];
+                assign_(term.negated(), *iter);
+                changed.push_back(term.package);
+            }
+        }
+    }
+}
+
+inline std::size_t pubgrub_solver_::resolve_conflict_(std::size_t incompatibility_id)
+{
+    bool is_new = false;
+    for (;;)
+    {
+        if (is_failure_(incompatibilities_[incompatibility_id]))
+            throw resolution_error(explain_(incompatibility_id));
+
+        // The satisfier is the earliest assignment after which the partial solution satisfies the incompatibility.
+        const std::vector<pubgrub_term_>& terms = incompatibilities_[incompatibility_id].terms;
+        std::vector<std::size_t> term_satisfiers(terms.size(), assignments_.size());
+        {
+            std::vector<pubgrub_term_> accumulated;
+            accumulated.reserve(terms.size());
+            for (const pubgrub_term_& term : terms)
+                accumulated.push_back(any_term_(term.package));
+            for (std::size_t index = 0; index < assignments_.size(); ++index)
+            {
+                for (std::size_t i = 0; i < terms.size(); ++i)
+                {
+                    if (term_satisfiers[i] != assignments_.size()
+                        || assignments_[index].term.package != terms[i].package)
+                        continue;
+                    accumulated[i] = accumulated[i].intersection(assignments_[index].term);
+                    if (accumulated[i].satisfies(terms[i]))
+                        term_satisfiers[i] = index;
+                }
+            }
+        }
+        const std::size_t satisfied_term_index =
+            std::max_element(term_satisfiers.begin(), term_satisfiers.end()) - term_satisfiers.begin();
+        const std::size_t satisfier_index = term_satisfiers[satisfied_term_index];
+        const assignment satisfier = assignments_[satisfier_index];
+        const pubgrub_term_ satisfied_term = terms[satisfied_term_index];
+
+        std::size_t previous_satisfier_level = 1;
+        for (std::size_t i = 0; i < terms.size(); ++i)
+        {
+            if (i != satisfied_term_index)
+                previous_satisfier_level =
+                    std::max(previous_satisfier_level, assignments_[term_satisfiers[i]].decision_level);
+        }
+        if (!satisfier.term.satisfies(satisfied_term))
+        {
+            pubgrub_term_ accumulated = satisfier.term;
+            for (std::size_t index = 0; index < satisfier_index; ++index)
+            {
+                if (assignments_[index].term.package != satisfied_term.package)
+                    continue;
+                accumulated = accumulated.intersection(assignments_[index].term);
+                if (accumulated.satisfies(satisfied_term))
+                {
+                    previous_satisfier_level =
+                        std::max(previous_satisfier_level, assignments_[index].decision_level);
+                    break;
+                }
+            }
+        }
+
+        if (!satisfier.cause || previous_satisfier_level != satisfier.decision_level)
+        {
+            if (is_new)
+                index_incompatibility_(incompatibility_id);
+            backtrack_(previous_satisfier_level);
+            return incompatibility_id;
+        }
+
+        // Resolution of the incompatibility with the cause of its satisfier.
+        std::vector<pubgrub_term_> prior_cause_terms;
+        for (const pubgrub_term_& term : terms)
+        {
+            if (term.package != satisfied_term.package)
+                prior_cause_terms.push_back(term);
+        }
+        for (const pubgrub_term_& term : incompatibilities_[*satisfier.cause].terms)
+        {
+            if (term.package != satisfied_term.package)
+                prior_cause_terms.push_back(term);
+        }
+        if (!satisfier.term.satisfies(satisfied_term))
+            prior_cause_terms.push_back(satisfier.term.intersection(satisfied_term.negated()).negated());
+        incompatibility_id = add_incompatibility_(std::move(prior_cause_terms), pubgrub_incompatibility_::kind::derived,
+                                                  incompatibility_id, *satisfier.cause);
+        is_new = true;
+    }
+}
+
+inline std::optional<std::size_t> pubgrub_solver_::decide_()
+{
+    // Package required by the partial solution and not decided yet, with the fewest allowed versions.
+    std::optional<std::size_t> package;
+    std::size_t version_count = 0;
+    for (std::size_t i = 0; i < packages_.size(); ++i)
+    {
+        const pubgrub_term_& accumulated = accumulated_terms_[i];
+        if (!accumulated.positive || decisions_[i])
+            continue;
+        const std::size_t count = accumulated.versions.count();
+        if (!package || count < version_count)
+        {
+            package = i;
+            version_count = count;
+        }
+    }
+    if (!package)
+        return std::nullopt;
+
+    const std::size_t version_index = accumulated_terms_[*package].versions.highest();
+    if (dependencies_added_.emplace(*package, version_index).second)
+    {
+        const std::vector<dependency> dependencies =
+            provider_.dependencies(packages_[*package].name, packages_[*package].versions[version_index]);
+        for (const dependency& dep : dependencies)
+        {
+            const std::size_t dependency_package = package_id_(dep.package);
+            pubgrub_term_ depender = any_term_(*package);
+            depender.positive = true;
+            depender.versions.set(version_index);
+            pubgrub_term_ dependee = any_term_(dependency_package);
+            const std::vector<semver>& dependency_versions = packages_[dependency_package].versions;
+            for (std::size_t i = 0; i < dependency_versions.size(); ++i)
+            {
+                if (dep.range.contains(dependency_versions[i]))
+                    dependee.versions.set(i);
+            }
+            const std::size_t id = add_incompatibility_({ std::move(depender), std::move(dependee) },
+                                                        pubgrub_incompatibility_::kind::dependency, 0, 0,
+                                                        dependency_package, dep.range);
+            index_incompatibility_(id);
+        }
+    }
+
+    pubgrub_term_ decision = any_term_(*package);
+    decision.positive = true;
+    decision.versions.set(version_index);
+    ++decision_level_;
+    assign_(std::move(decision), std::nullopt);
+    return package;
+}
+
+inline resolution pubgrub_solver_::solve(std::string_view root_package, const semver& root_version)
+{
+    root_ = package_id_(root_package);
+    const std::vector<semver>& root_versions = packages_[root_].versions;
+    const auto root_iter = std::lower_bound(root_versions.begin(), root_versions.end(), root_version);
+    if (root_iter == root_versions.end() || *root_iter != root_version)
+        throw std::invalid_argument(std::format("{} {} is not provided.", root_package, root_version));
+
+    pubgrub_term_ not_root = any_term_(root_);
+    not_root.versions.set(root_iter - root_versions.begin());
+    index_incompatibility_(add_incompatibility_({ std::move(not_root) }, pubgrub_incompatibility_::kind::root));
+
+    std::optional<std::size_t> next = root_;
+    while (next)
+    {
+        propagate_(*next);
+        next = decide_();
+    }
+
+    resolution result;
+    for (std::size_t package = 0; package < packages_.size(); ++package)
+    {
+        if (decisions_[package])
+            result.emplace(packages_[package].name, packages_[package].versions[*decisions_[package]]);
+    }
+    return result;
+}
+
+// Explanations:
+
+inline std::string pubgrub_solver_::describe_(const pubgrub_term_& term) const
+{
+    const package_info& info = packages_[term.package];
+    const version_bitset_& versions = term.versions;
+    std::string str = info.name;
+    if (versions.size() > 1 && versions.count() == versions.size())
+        return (term.positive ? "any version of " : "no version of ") + str;
+    if (!term.positive)
+        str = "not " + str;
+    if (versions.none())
+        return str + " (no version)";
+    // Runs of consecutive available versions.
+    const char* separator = " ";
+    for (std::size_t i = 0; i < versions.size(); ++i)
+    {
+        if (!versions.test(i))
+            continue;
+        std::size_t last = i;
+        while (last + 1 < versions.size() && versions.test(last + 1))
+            ++last;
+        str += separator;
+        if (last == i)
+            str += std::format("{}", info.versions[i]);
+        else
+            str += std::format("{} to {}", info.versions[i], info.versions[last]);
+        separator = " or ";
+        i = last;
+    }
+    return str;
+}
+
+inline std::string pubgrub_solver_::describe_(std::size_t incompatibility_id) const
+{
+    const pubgrub_incompatibility_& incompatibility = incompatibilities_[incompatibility_id];
+    const std::vector<pubgrub_term_>& terms = incompatibility.terms;
+    if (incompatibility.cause_kind == pubgrub_incompatibility_::kind::dependency && !terms.empty()
+        && terms.front().positive && terms.front().package != incompatibility.dependee)
+    {
+        const std::string& dependee = packages_[incompatibility.dependee].name;
+        if (terms.size() == 1)
+            return std::format("{} depends on {} {} (no matching version)", describe_(terms.front()), dependee,
+                               incompatibility.range.to_string());
+        return std::format("{} depends on {} {}", describe_(terms.front()), dependee,
+                           incompatibility.range.to_string());
+    }
+    if (is_failure_(incompatibility))
+        return "version solving failed";
+    if (terms.size() == 1)
+    {
+        if (terms.front().positive)
+            return std::format("{} is forbidden", describe_(terms.front()));
+        return std::format("{} is required", describe_(terms.front().negated()));
+    }
+    if (terms.size() == 2 && terms[0].positive != terms[1].positive)
+    {
+        const pubgrub_term_& positive = terms[0].positive ? terms[0] : terms[1];
+        const pubgrub_term_& negative = terms[0].positive ? terms[1] : terms[0];
+        return std::format("{} requires {}", describe_(positive), describe_(negative.negated()));
+    }
+    std::string str;
+    for (std::size_t i = 0; i < terms.size(); ++i)
+    {
+        if (i != 0)
+            str += (i + 1 == terms.size()) ? " and " : ", ";
+        str += describe_(terms[i]);
+    }
+    return str + " are incompatible";
+}
+
+inline std::string pubgrub_solver_::explain_(std::size_t failure_id) const
+{
+    // One numbered line per derived incompatibility, the causes being explained before their consequences.
+    std::vector<std::string> lines;
+    std::map<std::size_t, std::size_t> line_numbers;
+    const auto reference = [&](std::size_t id)
+    {
+        if (auto iter = line_numbers.find(id); iter != line_numbers.end())
+            return std::format("{} ({})", describe_(id), iter->second);
+        return describe_(id);
+    };
+    const auto explain = [&](const auto& self, std::size_t id) -> void
+    {
+        const pubgrub_incompatibility_& incompatibility = incompatibilities_[id];
+        if (incompatibility.cause_kind != pubgrub_incompatibility_::kind::derived || line_numbers.contains(id))
+            return;
+        self(self, incompatibility.causes[0]);
+        self(self, incompatibility.causes[1]);
+        lines.push_back(std::format("Because {} and {}, {}.", reference(incompatibility.causes[0]),
+                                    reference(incompatibility.causes[1]), describe_(id)));
+        line_numbers.emplace(id, lines.size());
+    };
+    explain(explain, failure_id);
+
+    std::string explanation;
+    for (std::size_t i = 0; i < lines.size(); ++i)
+        explanation += std::format("({}) {}\n", i + 1, lines[i]);
+    if (explanation.empty())
+        explanation = std::format("Because {}, version solving failed.\n", describe_(failure_id));
+    return explanation;
+}
+
+} // namespace private_
+
+// Select a version of each package transitively required by `root_version` of `root_package`, such that every
+// dependency range is satisfied, preferring the greatest versions. Conflicts are learnt as new incompatibilities
+// (PubGrub algorithm), which keeps the search from backtracking over the same conflict again.
+// Throw resolution_error with an explanation if there is no solution, and std::invalid_argument if `root_version` of
+// `root_package` is not provided.
+[[nodiscard]] inline resolution resolve(const package_provider& provider, std::string_view root_package,
+                                        const semver& root_version)
+{
+    return private_::pubgrub_solver_(provider).solve(root_package, root_version);
+}
+
+} // namespace vrsn
+} // namespace arba
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "_private/compare_pre_release.hpp"
 #include "_private/extract_semver.hpp"
 #include "concepts/semver.hpp"
 #include "numver.hpp"
@@ -43,6 +44,11 @@ public:
     using numver::up_minor;
     using numver::up_patch;
 
+    // Throw std::invalid_argument if the string is not a valid pre-release (or build metadata). The storage of the
+    // previous string is reused.
+    constexpr void set_pre_release(std::string_view pre_release);
+    constexpr void set_build_metadata(std::string_view build_metadata);
+
     inline constexpr bool operator==(const semver& other) const;
     inline constexpr bool operator<(const semver& other) const;
     inline constexpr bool operator!=(const semver& other) const { return !(other == *this); }
@@ -51,8 +57,6 @@ public:
     inline constexpr bool operator>=(const semver& other) const { return !(*this < other); }
 
 private:
-    constexpr bool pre_release_is_less_than_(const std::string& right_pr) const;
-
     static constexpr semver valid_semantic_version_(std::string_view semver);
     static constexpr std::string_view valid_pre_release_(std::string_view pre_release_version);
     static constexpr std::string_view valid_build_metadata_(std::string_view build_metadata);
@@ -67,12 +71,16 @@ constexpr semver::semver(uint64_t major, uint32_t minor, uint32_t patch, std::st
     : numver(major, minor, patch), pre_release_(valid_pre_release_(pre_release)),
       build_metadata_(valid_build_metadata_(build_metadata))
 {
+    private_::count_string_storage_(pre_release_.size());
+    private_::count_string_storage_(build_metadata_.size());
 }
 
 constexpr semver::semver(const Numver auto& version_core, std::string_view pre_release, std::string_view build_metadata)
     : numver(version_core.major(), version_core.minor(), version_core.patch()),
       pre_release_(valid_pre_release_(pre_release)), build_metadata_(valid_build_metadata_(build_metadata))
 {
+    private_::count_string_storage_(pre_release_.size());
+    private_::count_string_storage_(build_metadata_.size());
 }
 
 constexpr semver::semver(std::string_view version) : numver(), pre_release_(), build_metadata_()
@@ -80,118 +88,46 @@ constexpr semver::semver(std::string_view version) : numver(), pre_release_(), b
     *this = valid_semantic_version_(version);
 }
 
-inline constexpr bool semver::operator==(const semver& other) const
+constexpr void semver::set_pre_release(std::string_view pre_release)
 {
-    return static_cast<const numver&>(*this) == static_cast<const numver&>(other) && pre_release_ == other.pre_release_;
+    const std::string_view valid_pre_release = valid_pre_release_(pre_release);
+    if (valid_pre_release.size() > pre_release_.capacity())
+        private_::count_string_storage_(valid_pre_release.size());
+    pre_release_.assign(valid_pre_release);
 }
 
-inline constexpr bool semver::operator<(const semver& other) const
+constexpr void semver::set_build_metadata(std::string_view build_metadata)
 {
-    auto cmp_res = static_cast<const numver&>(*this) <=> static_cast<const numver&>(other);
-    return cmp_res < 0 || (cmp_res == 0 && pre_release_is_less_than_(other.pre_release_));
+    const std::string_view valid_build_metadata = valid_build_metadata_(build_metadata);
+    if (valid_build_metadata.size() > build_metadata_.capacity())
+        private_::count_string_storage_(valid_build_metadata.size());
+    build_metadata_.assign(valid_build_metadata);
 }
 
-constexpr bool semver::pre_release_is_less_than_(const std::string& right_pr) const
+inline constexpr bool semver::operator==(const semver& other) const
 {
-    if (pre_release_.empty())
-        return false;
-    else if (right_pr.empty())
-        return true;
-
-    bool left_is_shortest = false;
-    bool left_is_num = true;
-    bool right_is_num = true;
-
-    const auto left_end_iter = pre_release_.end();
-    const auto right_end_iter = right_pr.end();
-    auto left_iter = pre_release_.begin();
-    auto right_iter = right_pr.begin();
-    char left_ch = '\0';
-    char right_ch = '\0';
-
-    auto left_part_iter = left_iter;
-    auto right_part_iter = right_iter;
-
-    for (;;)
-    {
-        if (left_iter == left_end_iter)
-        {
-            if (right_iter == right_end_iter)
-                return false;
-            left_is_shortest = true;
-            break;
-        }
-        else if (right_iter == right_end_iter)
-            break;
-
-        left_ch = *left_iter;
-        right_ch = *right_iter;
-        if (left_ch != right_ch)
-            break;
-
-        ++left_iter, ++right_iter;
-        if (left_ch == '.')
-        {
-            left_is_num = true;
-            left_part_iter = left_iter;
-            right_part_iter = right_iter;
-            // save first char pos of the part.
-        }
-        else
-            left_is_num = left_is_num && (left_ch >= '0' && left_ch <= '9');
-    }
-
-    right_is_num = left_is_num;
-    bool left_is_lt = left_ch < right_ch;
-    bool length_break = true;
-
-    if (left_ch != right_ch)
-    {
-        length_break = false;
-        left_is_num = left_is_num && (left_ch >= '0' && left_ch <= '9');
-        right_is_num = right_is_num && (right_ch >= '0' && right_ch <= '9');
-        if (!left_is_num && !right_is_num)
-            return left_is_lt;
-    }
-    else if (!left_is_num && !right_is_num)
-    {
-        return left_is_shortest;
-    }
-
-    for (; left_iter != left_end_iter && left_is_num; ++left_iter)
-    {
-        left_ch = *left_iter;
-        if (left_ch == '.')
-            break;
-        left_is_num = left_is_num && (left_ch >= '0' && left_ch <= '9');
-    }
-
-    for (; right_iter != right_end_iter && right_is_num; ++right_iter)
-    {
-        right_ch = *right_iter;
-        if (right_ch == '.')
-            break;
-        right_is_num = right_is_num && (right_ch >= '0' && right_ch <= '9');
-    }
+    private_::count_stat_(stat_counter::comparison);
+    return static_cast<const numver&>(*this) == static_cast<const numver&>(other) && pre_release_ == other.pre_release_;
+}
 
-    if (left_is_num)
-    {
-        if (!right_is_num)
-            return true;
-        unsigned left_number = std::stoi(std::string(left_part_iter, left_iter));
-        unsigned right_number = std::stoi(std::string(right_part_iter, right_iter));
-        return left_number < right_number || (length_break && left_is_shortest);
-    }
-    if (right_is_num)
-        return false;
-    return left_is_lt;
+inline constexpr bool semver::operator<(const semver& other) const
+{
+    private_::count_stat_(stat_counter::comparison);
+    auto cmp_res = static_cast<const numver&>(*this) <=> static_cast<const numver&>(other);
+    if (cmp_res != 0)
+        return cmp_res < 0;
+    private_::count_stat_(stat_counter::pre_release_comparison);
+    return private_::pre_release_is_less_than_(pre_release_, other.pre_release_);
 }
 
 constexpr semver semver::valid_semantic_version_(std::string_view semver_str)
 {
+    private_::count_stat_(stat_counter::semver_parse);
+    [[maybe_unused]] const private_::stats_timer_ timer(stat_counter::semver_parse_time);
     std::string_view major, minor, patch, pr, bm;
     if (!private_::extract_semver_(semver_str, major, minor, patch, pr, bm)) [[unlikely]]
     {
+        private_::count_stat_(stat_counter::invalid_semver);
         if (std::is_constant_evaluated())
         {
             compile_time_error("'semver' is not a valid semantic version.");
@@ -208,6 +144,7 @@ constexpr std::string_view semver::valid_pre_release_(std::string_view pre_relea
     {
         if (!private_::extract_pre_release_(pre_release_version, pre_release_version)) [[unlikely]]
         {
+            private_::count_stat_(stat_counter::invalid_pre_release);
             if (std::is_constant_evaluated())
             {
                 compile_time_error("'pre_release_version' is not a valid pre-release version.");
@@ -225,6 +162,7 @@ constexpr std::string_view semver::valid_build_metadata_(std::string_view build_
     {
         if (!private_::check_build_metadata_(build_metadata)) [[unlikely]]
         {
+            private_::count_stat_(stat_counter::invalid_build_metadata);
             if (std::is_constant_evaluated())
             {
                 compile_time_error("'build_metadata' is not a valid build metadata string.");
@@ -236,6 +174,49 @@ constexpr std::string_view semver::valid_build_metadata_(std::string_view build_
     return build_metadata;
 }
 
+namespace private_
+{
+
+[[nodiscard]] inline constexpr std::size_t semver_max_formatted_size_(std::string_view pre_release,
+                                                                      std::string_view build_metadata) noexcept
+{
+    return numver_max_formatted_size_ + (pre_release.empty() ? 0 : pre_release.size() + 1)
+           + (build_metadata.empty() ? 0 : build_metadata.size() + 1);
+}
+
+inline constexpr std::to_chars_result semver_to_chars_(char* first, char* last, const numver& core,
+                                                       std::string_view pre_release,
+                                                       std::string_view build_metadata) noexcept
+{
+    std::to_chars_result res = to_chars(first, last, core);
+    if (res.ec != std::errc{})
+        return res;
+    for (const auto& [separator, str] : { std::pair('-', pre_release), std::pair('+', build_metadata) })
+    {
+        if (str.empty())
+            continue;
+        if (static_cast<std::size_t>(last - res.ptr) < str.size() + 1)
+            return { last, std::errc::value_too_large };
+        *res.ptr++ = separator;
+        res.ptr = std::copy(str.begin(), str.end(), res.ptr);
+    }
+    return res;
+}
+
+} // namespace private_
+
+// Upper bound of the number of characters written by to_chars() for `version`.
+[[nodiscard]] inline constexpr std::size_t max_formatted_size(const semver& version) noexcept
+{
+    return private_::semver_max_formatted_size_(version.pre_release(), version.build_metadata());
+}
+
+// Write the full version string in [first, last). On failure, return { last, std::errc::value_too_large }.
+inline constexpr std::to_chars_result to_chars(char* first, char* last, const semver& version) noexcept
+{
+    return private_::semver_to_chars_(first, last, version.core(), version.pre_release(), version.build_metadata());
+}
+
 } // namespace vrsn
 } // namespace arba
 
@@ -290,15 +271,30 @@ struct std::formatter<::arba::vrsn::semver, CharT>
     template <class FormatContext>
     auto format(const ::arba::vrsn::semver& version, FormatContext& ctx) const
     {
-        auto iter = std::format_to(ctx.out(), "{}", version.core());
-        if (pr_ && !version.pre_release().empty())
-            iter = std::format_to(iter, "-{}", version.pre_release());
-        if (bm_ && !version.build_metadata().empty())
-            iter = std::format_to(iter, "+{}", version.build_metadata());
+        return format_parts_(version.core(), version.pre_release(), version.build_metadata(), ctx);
+    }
+
+protected:
+    template <class FormatContext>
+    auto format_parts_(const ::arba::vrsn::numver& core, std::string_view pre_release,
+                       std::string_view build_metadata, FormatContext& ctx) const
+    {
+        char buffer[::arba::vrsn::private_::numver_max_formatted_size_];
+        const std::to_chars_result res = ::arba::vrsn::to_chars(std::begin(buffer), std::end(buffer), core);
+        auto iter = std::copy(std::begin(buffer), res.ptr, ctx.out());
+        if (pr_ && !pre_release.empty())
+        {
+            *iter++ = CharT('-');
+            iter = std::copy(pre_release.begin(), pre_release.end(), iter);
+        }
+        if (bm_ && !build_metadata.empty())
+        {
+            *iter++ = CharT('+');
+            iter = std::copy(build_metadata.begin(), build_metadata.end(), iter);
+        }
         return iter;
     }
 
-private:
     bool pr_{ true };
     bool bm_{ true };
 };
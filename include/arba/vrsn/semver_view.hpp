@@ -0,0 +1,145 @@
+#pragma once
+
+#include "semver.hpp"
+
+#include <optional>
+
+inline namespace arba
+{
+namespace vrsn
+{
+
+// Non-owning semantic version: the pre-release and build metadata strings refer to external storage
+// (a semver, a parsed string, a mapped file, ...) which must outlive the view.
+class semver_view
+{
+public:
+    constexpr semver_view() = default;
+    // clang-format off
+    constexpr explicit semver_view(const numver& version_core,
+                                   std::string_view pre_release = std::string_view(),
+                                   std::string_view build_metadata = std::string_view());
+    // clang-format on
+    constexpr semver_view(const semver& version) noexcept;
+    constexpr explicit semver_view(std::string_view version);
+
+    // Non-throwing parse: none if `version` is not a valid semantic version.
+    [[nodiscard]] static constexpr std::optional<semver_view> try_parse(std::string_view version);
+
+    constexpr const numver& core() const noexcept { return core_; }
+    constexpr uint64_t major() const noexcept { return core_.major(); }
+    constexpr uint32_t minor() const noexcept { return core_.minor(); }
+    constexpr uint32_t patch() const noexcept { return core_.patch(); }
+    constexpr std::string_view pre_release() const noexcept { return pre_release_; }
+    constexpr std::string_view build_metadata() const noexcept { return build_metadata_; }
+
+    inline constexpr bool is_major_compatible_with(const Numver auto& rv) const noexcept
+    {
+        return vrsn::is_major_compatible_with(*this, rv);
+    }
+
+    inline constexpr bool is_minor_compatible_with(const Numver auto& rv) const noexcept
+    {
+        return vrsn::is_minor_compatible_with(*this, rv);
+    }
+
+    inline constexpr bool is_patch_compatible_with(const Numver auto& rv) const noexcept
+    {
+        return vrsn::is_patch_compatible_with(*this, rv);
+    }
+
+    inline constexpr semver to_semver() const { return semver(core_, pre_release_, build_metadata_); }
+
+    inline constexpr bool operator==(const semver_view& other) const
+    {
+        private_::count_stat_(stat_counter::comparison);
+        return core_ == other.core_ && pre_release_ == other.pre_release_;
+    }
+    inline constexpr bool operator<(const semver_view& other) const
+    {
+        private_::count_stat_(stat_counter::comparison);
+        auto cmp_res = core_ <=> other.core_;
+        if (cmp_res != 0)
+            return cmp_res < 0;
+        private_::count_stat_(stat_counter::pre_release_comparison);
+        return private_::pre_release_is_less_than_(pre_release_, other.pre_release_);
+    }
+    inline constexpr bool operator!=(const semver_view& other) const { return !(other == *this); }
+    inline constexpr bool operator>(const semver_view& other) const { return other < *this; }
+    inline constexpr bool operator<=(const semver_view& other) const { return !(other < *this); }
+    inline constexpr bool operator>=(const semver_view& other) const { return !(*this < other); }
+
+private:
+    numver core_;
+    std::string_view pre_release_;
+    std::string_view build_metadata_;
+};
+
+constexpr semver_view::semver_view(const numver& version_core, std::string_view pre_release,
+                                   std::string_view build_metadata)
+    : core_(version_core), pre_release_(pre_release), build_metadata_(build_metadata)
+{
+}
+
+constexpr semver_view::semver_view(const semver& version) noexcept
+    : core_(version.core()), pre_release_(version.pre_release()), build_metadata_(version.build_metadata())
+{
+}
+
+namespace private_
+{
+
+// Non-throwing parse: return false if `version_str` is not a valid semantic version.
+[[nodiscard]] constexpr bool extract_semver_view_(std::string_view version_str, semver_view& version)
+{
+    count_stat_(stat_counter::semver_parse);
+    [[maybe_unused]] const stats_timer_ timer(stat_counter::semver_parse_time);
+    std::string_view major, minor, patch, pre_release, build_metadata;
+    if (!extract_semver_(version_str, major, minor, patch, pre_release, build_metadata))
+    {
+        count_stat_(stat_counter::invalid_semver);
+        return false;
+    }
+    version = semver_view(numver(stoi64(major), stoi64(minor), stoi64(patch)), pre_release, build_metadata);
+    return true;
+}
+
+} // namespace private_
+
+constexpr semver_view::semver_view(std::string_view version)
+{
+    if (!private_::extract_semver_view_(version, *this)) [[unlikely]]
+        throw std::invalid_argument(std::string(version));
+}
+
+constexpr std::optional<semver_view> semver_view::try_parse(std::string_view version)
+{
+    semver_view result;
+    if (!private_::extract_semver_view_(version, result))
+        return std::nullopt;
+    return result;
+}
+
+// Upper bound of the number of characters written by to_chars() for `version`.
+[[nodiscard]] inline constexpr std::size_t max_formatted_size(const semver_view& version) noexcept
+{
+    return private_::semver_max_formatted_size_(version.pre_release(), version.build_metadata());
+}
+
+inline constexpr std::to_chars_result to_chars(char* first, char* last, const semver_view& version) noexcept
+{
+    return private_::semver_to_chars_(first, last, version.core(), version.pre_release(), version.build_metadata());
+}
+
+} // namespace vrsn
+} // namespace arba
+
+template <class CharT>
+struct std::formatter<::arba::vrsn::semver_view, CharT> : std::formatter<::arba::vrsn::semver, CharT>
+{
+    template <class FormatContext>
+    auto format(const ::arba::vrsn::semver_view& version, FormatContext& ctx) const
+    {
+        return this->format_parts_(version.core(), version.pre_release(), version.build_metadata(), ctx);
+    }
+};
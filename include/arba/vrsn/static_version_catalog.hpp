@@ -0,0 +1,211 @@
+#pragma once
+
+#include "semver_view.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+
+inline namespace arba
+{
+namespace vrsn
+{
+
+namespace private_
+{
+
+[[nodiscard]] inline constexpr uint64_t mix_hash_(uint64_t value) noexcept
+{
+    value ^= value >> 30;
+    value *= 0xbf58476d1ce4e5b9;
+    value ^= value >> 27;
+    value *= 0x94d049bb133111eb;
+    return value ^ (value >> 31);
+}
+
+// Hash of the precedence of `version` (the build metadata is ignored, like by operator==).
+[[nodiscard]] inline constexpr uint64_t precedence_hash_(const semver_view& version) noexcept
+{
+    uint64_t hash = mix_hash_(version.major());
+    hash = mix_hash_(hash ^ ((uint64_t(version.minor()) << 32) | version.patch()));
+    for (char ch : version.pre_release())
+        hash = (hash ^ static_cast<unsigned char>(ch)) * 0x100000001b3; // FNV-1a step
+    return mix_hash_(hash);
+}
+
+} // namespace private_
+
+// Set of versions built at compile time, for checks against embedded lists (deprecated SDK versions, blocked
+// releases, ...) which cost neither a static initialization nor an allocation:
+//
+//   static constexpr auto blocked_versions = make_static_version_catalog({ "1.4.2", "2.0.0-rc.1", "1.4.2+hotfix" });
+//   if (blocked_versions.contains(peer_version)) ...
+//
+// The versions are parsed, validated, sorted and deduplicated (by precedence) at compile time, and refer to the
+// string literals. Membership is tested with a perfect hash built at compile time: one hash, one displacement and one
+// version comparison. Range queries are binary searches in the sorted versions.
+// Capacity is the number of literals: the catalog holds size() <= Capacity versions once deduplicated.
+template <std::size_t Capacity>
+class static_version_catalog
+{
+public:
+    static constexpr std::size_t capacity = Capacity;
+
+    consteval explicit static_version_catalog(const std::string_view (&versions)[Capacity]);
+
+    [[nodiscard]] inline constexpr std::size_t size() const noexcept { return size_; }
+    [[nodiscard]] inline constexpr bool empty() const noexcept { return size_ == 0; }
+    [[nodiscard]] inline constexpr std::span<const semver_view> versions() const noexcept
+    {
+        return std::span<const semver_view>(versions_.data(), size_);
+    }
+    [[nodiscard]] inline constexpr auto begin() const noexcept { return versions().begin(); }
+    [[nodiscard]] inline constexpr auto end() const noexcept { return versions().end(); }
+
+    // True if a version of the catalog has the precedence of `version` (the build metadata is ignored).
+    [[nodiscard]] inline constexpr bool contains(const semver_view& version) const noexcept
+    {
+        const uint64_t hash = private_::precedence_hash_(version);
+        const uint32_t index = slots_[slot_(hash, displacements_[hash % bucket_count_])];
+        return index != empty_slot_ && versions_[index] == version;
+    }
+
+    // Versions in [lower, upper), in ascending order.
+    [[nodiscard]] inline constexpr std::span<const semver_view> between(const semver_view& lower,
+                                                                        const semver_view& upper) const
+    {
+        const auto first = std::lower_bound(begin(), end(), lower);
+        return std::span<const semver_view>(first, std::lower_bound(first, end(), upper));
+    }
+    // Versions compatible with `version` according to `policy` (see is_compatible_with(): only the version cores are
+    // compared), in ascending order.
+    [[nodiscard]] inline constexpr std::span<const semver_view> compatible_with(const Numver auto& version,
+                                                                                compatibility policy) const
+    {
+        const numver core(version);
+        const auto first = std::partition_point(begin(), end(), [&](const semver_view& candidate)
+                                                { return candidate.core() < core; });
+        const auto last = std::partition_point(first, end(), [&](const semver_view& candidate)
+                                               { return is_compatible_with(candidate, core, policy); });
+        return std::span<const semver_view>(first, last);
+    }
+
+private:
+    static constexpr std::size_t bucket_count_ = Capacity / 2 + 1;
+    static constexpr std::size_t slot_count_ = std::bit_ceil(2 * Capacity + 1);
+    static constexpr uint32_t empty_slot_ = std::numeric_limits<uint32_t>::max();
+
+    static_assert(Capacity < empty_slot_);
+
+    [[nodiscard]] inline static constexpr std::size_t slot_(uint64_t hash, uint32_t displacement) noexcept
+    {
+        return private_::mix_hash_(hash + displacement * 0x9e3779b97f4a7c15) & (slot_count_ - 1);
+    }
+
+    consteval void build_hash_table_();
+
+private:
+    std::array<semver_view, Capacity> versions_{};
+    std::size_t size_ = 0;
+    std::array<uint32_t, bucket_count_> displacements_{};
+    std::array<uint32_t, slot_count_> slots_{};
+};
+
+template <std::size_t Capacity>
+consteval static_version_catalog<Capacity>::static_version_catalog(const std::string_view (&versions)[Capacity])
+{
+    for (std::size_t index = 0; index < Capacity; ++index)
+    {
+        if (!private_::extract_semver_view_(versions[index], versions_[index]))
+            throw std::invalid_argument("A version of the catalog is not a valid semantic version.");
+    }
+    std::sort(versions_.begin(), versions_.end());
+    size_ = static_cast<std::size_t>(std::unique(versions_.begin(), versions_.end()) - versions_.begin());
+    build_hash_table_();
+}
+
+// Hash and displace: the versions are distributed in buckets, and the buckets, largest first, are given the first
+// displacement placing all their versions in free slots. With twice as many slots as versions, a few displacements
+// are tried per bucket. The members of the buckets are grouped once by a counting sort.
+template <std::size_t Capacity>
+consteval void static_version_catalog<Capacity>::build_hash_table_()
+{
+    slots_.fill(empty_slot_);
+    std::array<uint64_t, Capacity> hashes{};
+    std::array<std::size_t, bucket_count_> bucket_sizes{};
+    for (std::size_t index = 0; index < size_; ++index)
+    {
+        hashes[index] = private_::precedence_hash_(versions_[index]);
+        ++bucket_sizes[hashes[index] % bucket_count_];
+    }
+    // Members of bucket b: bucket_members[bucket_starts[b], bucket_starts[b] + bucket_sizes[b]).
+    std::array<std::size_t, bucket_count_ + 1> bucket_starts{};
+    for (std::size_t bucket = 0; bucket < bucket_count_; ++bucket)
+        bucket_starts[bucket + 1] = bucket_starts[bucket] + bucket_sizes[bucket];
+    std::array<uint32_t, Capacity> bucket_members{};
+    std::array<std::size_t, bucket_count_> bucket_fills{};
+    for (std::size_t index = 0; index < size_; ++index)
+    {
+        const std::size_t bucket = hashes[index] % bucket_count_;
+        bucket_members[bucket_starts[bucket] + bucket_fills[bucket]++] = static_cast<uint32_t>(index);
+    }
+
+    std::array<uint32_t, bucket_count_> buckets{};
+    for (std::size_t bucket = 0; bucket < bucket_count_; ++bucket)
+        buckets[bucket] = static_cast<uint32_t>(bucket);
+    std::sort(buckets.begin(), buckets.end(),
+              [&](uint32_t lhs, uint32_t rhs)
+              {
+                  return bucket_sizes[lhs] != bucket_sizes[rhs] ? bucket_sizes[lhs] > bucket_sizes[rhs] : lhs < rhs;
+              });
+
+    for (uint32_t bucket : buckets)
+    {
+        if (bucket_sizes[bucket] == 0)
+            break;
+        const uint32_t* const members = bucket_members.data() + bucket_starts[bucket];
+        const std::size_t member_count = bucket_sizes[bucket];
+        for (uint32_t displacement = 0;; ++displacement)
+        {
+            if (displacement == empty_slot_)
+                throw std::logic_error("No perfect hash found for the catalog.");
+            bool placed = true;
+            std::size_t placed_count = 0;
+            for (; placed_count < member_count; ++placed_count)
+            {
+                const uint32_t index = members[placed_count];
+                uint32_t& slot = slots_[slot_(hashes[index], displacement)];
+                if (slot != empty_slot_)
+                {
+                    placed = false;
+                    break;
+                }
+                slot = index;
+            }
+            if (placed)
+            {
+                displacements_[bucket] = displacement;
+                break;
+            }
+            for (std::size_t undo = 0; undo < placed_count; ++undo)
+                slots_[slot_(hashes[members[undo]], displacement)] = empty_slot_;
+        }
+    }
+}
+
+// Catalog of the versions `versions`. The call must be constant-evaluated: an invalid version is a compilation error.
+template <std::size_t Capacity>
+[[nodiscard]] consteval static_version_catalog<Capacity>
+make_static_version_catalog(const std::string_view (&versions)[Capacity])
+{
+    return static_version_catalog<Capacity>(versions);
+}
+
+} // namespace vrsn
+} // namespace arba
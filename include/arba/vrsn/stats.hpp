@@ -0,0 +1,252 @@
+#pragma once
+
+// Instrumentation of the hot paths of the library, disabled by default.
+// Define ARBA_VRSN_ENABLE_STATS to 1 (in every translation unit) to count parses, parse failures, comparisons and
+// string allocations, and ARBA_VRSN_ENABLE_STATS_TIMING to 1 to measure the time spent parsing as well, with
+// std::chrono::steady_clock (nanoseconds), or with the time-stamp counter (ticks) if ARBA_VRSN_STATS_USE_RDTSC is 1.
+// When disabled, the hooks are empty constexpr functions and take_stats_snapshot() returns zeros.
+
+#ifndef ARBA_VRSN_ENABLE_STATS
+#define ARBA_VRSN_ENABLE_STATS 0
+#endif
+#ifndef ARBA_VRSN_ENABLE_STATS_TIMING
+#define ARBA_VRSN_ENABLE_STATS_TIMING 0
+#endif
+#ifndef ARBA_VRSN_STATS_USE_RDTSC
+#define ARBA_VRSN_STATS_USE_RDTSC 0
+#endif
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+#if ARBA_VRSN_ENABLE_STATS
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <vector>
+#if ARBA_VRSN_STATS_USE_RDTSC
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#else
+#error "ARBA_VRSN_STATS_USE_RDTSC requires an x86 target."
+#endif
+#endif
+#endif
+
+inline namespace arba
+{
+namespace vrsn
+{
+
+inline constexpr bool stats_enabled = ARBA_VRSN_ENABLE_STATS != 0;
+inline constexpr bool stats_timing_enabled = stats_enabled && ARBA_VRSN_ENABLE_STATS_TIMING != 0;
+
+enum class stat_counter : std::size_t
+{
+    numver_parse,           // numver constructed from a string
+    semver_parse,           // semver or semver_view constructed from a string
+    invalid_numver,         // invalid numver string
+    invalid_semver,         // invalid semver string
+    invalid_pre_release,    // invalid pre-release given to a semver constructor
+    invalid_build_metadata, // invalid build metadata given to a semver constructor
+    comparison,             // semver or semver_view compared with == or <
+    pre_release_comparison, // comparison of two pre-releases (the version cores being equal)
+    allocation,             // semver strings too long for the small string buffer
+    allocated_bytes,        // bytes allocated for these strings
+    numver_parse_time,      // time spent parsing numver strings (if the timing is enabled)
+    semver_parse_time,      // time spent parsing semver strings (if the timing is enabled)
+};
+
+inline constexpr std::size_t stat_counter_count = static_cast<std::size_t>(stat_counter::semver_parse_time) + 1;
+
+[[nodiscard]] inline constexpr std::string_view stat_counter_name(stat_counter counter) noexcept
+{
+    constexpr std::array<std::string_view, stat_counter_count> names{
+        "numver_parse",       "semver_parse",           "invalid_numver",
+        "invalid_semver",     "invalid_pre_release",    "invalid_build_metadata",
+        "comparison",         "pre_release_comparison", "allocation",
+        "allocated_bytes",    "numver_parse_time",      "semver_parse_time",
+    };
+    return names[static_cast<std::size_t>(counter)];
+}
+
+// Values of the counters summed over all the threads, at some point in time.
+struct stats_snapshot
+{
+    std::array<uint64_t, stat_counter_count> counters{};
+
+    [[nodiscard]] inline constexpr uint64_t operator[](stat_counter counter) const noexcept
+    {
+        return counters[static_cast<std::size_t>(counter)];
+    }
+
+    // Counts between two snapshots.
+    [[nodiscard]] inline constexpr friend stats_snapshot operator-(const stats_snapshot& lhs,
+                                                                   const stats_snapshot& rhs) noexcept
+    {
+        stats_snapshot result;
+        for (std::size_t index = 0; index < stat_counter_count; ++index)
+            result.counters[index] = lhs.counters[index] - rhs.counters[index];
+        return result;
+    }
+
+    bool operator==(const stats_snapshot&) const = default;
+};
+
+#if ARBA_VRSN_ENABLE_STATS
+
+namespace private_
+{
+
+// Counters of a thread, only written by it. Each thread has its own cache lines.
+struct alignas(64) thread_stats_
+{
+    std::array<std::atomic<uint64_t>, stat_counter_count> counters{};
+};
+
+class stats_registry_
+{
+public:
+    inline static stats_registry_& instance()
+    {
+        static stats_registry_ registry;
+        return registry;
+    }
+
+    inline void attach(thread_stats_& stats)
+    {
+        std::scoped_lock lock(mutex_);
+        threads_.push_back(&stats);
+    }
+
+    // Keep the counts of an exiting thread.
+    inline void detach(thread_stats_& stats)
+    {
+        std::scoped_lock lock(mutex_);
+        for (std::size_t index = 0; index < stat_counter_count; ++index)
+            exited_threads_.counters[index] += stats.counters[index].load(std::memory_order_relaxed);
+        std::erase(threads_, &stats);
+    }
+
+    inline stats_snapshot snapshot()
+    {
+        std::scoped_lock lock(mutex_);
+        stats_snapshot result = exited_threads_;
+        for (const thread_stats_* stats : threads_)
+        {
+            for (std::size_t index = 0; index < stat_counter_count; ++index)
+                result.counters[index] += stats->counters[index].load(std::memory_order_relaxed);
+        }
+        return result;
+    }
+
+private:
+    std::mutex mutex_;
+    std::vector<thread_stats_*> threads_;
+    stats_snapshot exited_threads_;
+};
+
+class thread_stats_registration_
+{
+public:
+    inline thread_stats_registration_() { stats_registry_::instance().attach(stats); }
+    inline ~thread_stats_registration_() { stats_registry_::instance().detach(stats); }
+
+    thread_stats_ stats;
+};
+
+inline void record_stat_(stat_counter counter, uint64_t count) noexcept
+{
+    thread_local thread_stats_registration_ registration;
+    std::atomic<uint64_t>& value = registration.stats.counters[static_cast<std::size_t>(counter)];
+    // Single writer: no read-modify-write instruction needed.
+    value.store(value.load(std::memory_order_relaxed) + count, std::memory_order_relaxed);
+}
+
+inline uint64_t stats_clock_() noexcept
+{
+#if ARBA_VRSN_STATS_USE_RDTSC
+    return __rdtsc();
+#else
+    return static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+}
+
+} // namespace private_
+
+// Counters summed over all the threads, including the exited ones.
+[[nodiscard]] inline stats_snapshot take_stats_snapshot()
+{
+    return private_::stats_registry_::instance().snapshot();
+}
+
+#else
+
+[[nodiscard]] inline constexpr stats_snapshot take_stats_snapshot() noexcept
+{
+    return {};
+}
+
+#endif
+
+namespace private_
+{
+
+// Hooks called by the library. Calls made during constant evaluation are not counted.
+
+inline constexpr void count_stat_([[maybe_unused]] stat_counter counter, [[maybe_unused]] uint64_t count = 1) noexcept
+{
+#if ARBA_VRSN_ENABLE_STATS
+    if (!std::is_constant_evaluated())
+        record_stat_(counter, count);
+#endif
+}
+
+// A string of `size` characters stored by a semver.
+inline constexpr void count_string_storage_([[maybe_unused]] std::size_t size) noexcept
+{
+#if ARBA_VRSN_ENABLE_STATS
+    if (!std::is_constant_evaluated() && size > std::string().capacity())
+    {
+        record_stat_(stat_counter::allocation, 1);
+        record_stat_(stat_counter::allocated_bytes, size + 1);
+    }
+#endif
+}
+
+// Add the lifetime of the timer to a time counter.
+class stats_timer_
+{
+public:
+#if ARBA_VRSN_ENABLE_STATS && ARBA_VRSN_ENABLE_STATS_TIMING
+    inline constexpr explicit stats_timer_(stat_counter counter) noexcept : counter_(counter)
+    {
+        if (!std::is_constant_evaluated())
+            start_ = stats_clock_();
+    }
+    inline constexpr ~stats_timer_()
+    {
+        if (!std::is_constant_evaluated())
+            record_stat_(counter_, stats_clock_() - start_);
+    }
+    stats_timer_(const stats_timer_&) = delete;
+    stats_timer_& operator=(const stats_timer_&) = delete;
+
+private:
+    stat_counter counter_;
+    uint64_t start_ = 0;
+#else
+    inline constexpr explicit stats_timer_(stat_counter) noexcept {}
+#endif
+};
+
+} // namespace private_
+
+} // namespace vrsn
+} // namespace arba
@@ -9,7 +9,7 @@ inline namespace arba
 namespace vrsn
 {
 
-static constexpr int64_t stoi64(std::string_view str)
+inline constexpr int64_t stoi64(std::string_view str)
 {
     constexpr std::string_view spaces = " \f\n\r\t\v";
     std::size_t pos = str.find_first_not_of(spaces);
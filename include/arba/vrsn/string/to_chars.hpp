@@ -0,0 +1,65 @@
+#pragma once
+
+#include <charconv>
+#include <cstdint>
+#include <system_error>
+
+inline namespace arba
+{
+namespace vrsn
+{
+namespace private_
+{
+
+[[nodiscard]] inline constexpr std::size_t count_digits_(uint64_t value) noexcept
+{
+    std::size_t digits = 1;
+    for (; value >= 100; value /= 100)
+        digits += 2;
+    return digits + (value >= 10);
+}
+
+// Write the `digits` decimal digits of `value` at `first` (two digits per step). Return the end of the number.
+inline constexpr char* write_digits_(char* first, uint64_t value, std::size_t digits) noexcept
+{
+    constexpr char digit_pairs[] = "00010203040506070809"
+                                   "10111213141516171819"
+                                   "20212223242526272829"
+                                   "30313233343536373839"
+                                   "40414243444546474849"
+                                   "50515253545556575859"
+                                   "60616263646566676869"
+                                   "70717273747576777879"
+                                   "80818283848586878889"
+                                   "90919293949596979899";
+
+    char* const end = first + digits;
+    char* iter = end;
+    for (; value >= 100; value /= 100)
+    {
+        const std::size_t pair_index = (value % 100) * 2;
+        *--iter = digit_pairs[pair_index + 1];
+        *--iter = digit_pairs[pair_index];
+    }
+    if (value >= 10)
+    {
+        *--iter = digit_pairs[value * 2 + 1];
+        *--iter = digit_pairs[value * 2];
+    }
+    else
+        *--iter = static_cast<char>('0' + value);
+    return end;
+}
+
+// constexpr equivalent of std::to_chars for unsigned integers in base 10.
+inline constexpr std::to_chars_result uint_to_chars_(char* first, char* last, uint64_t value) noexcept
+{
+    const std::size_t digits = count_digits_(value);
+    if (static_cast<std::size_t>(last - first) < digits)
+        return { last, std::errc::value_too_large };
+    return { write_digits_(first, value, digits), std::errc{} };
+}
+
+} // namespace private_
+} // namespace vrsn
+} // namespace arba
@@ -0,0 +1,167 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
+inline namespace arba
+{
+namespace vrsn
+{
+
+// Set of indices stored as sorted, disjoint and non-adjacent runs [begin, end). Selections of a sorted version array by
+// a version range are made of a few runs, whatever the number of selected versions.
+// Combinations are linear in the number of runs.
+class version_bitmap
+{
+public:
+    struct run
+    {
+        std::size_t begin;
+        std::size_t end;
+
+        bool operator==(const run&) const = default;
+    };
+
+    // Empty bitmap.
+    version_bitmap() = default;
+    // Indices in [begin, end).
+    inline static version_bitmap range(std::size_t begin, std::size_t end)
+    {
+        version_bitmap bitmap;
+        bitmap.append(begin, end);
+        return bitmap;
+    }
+
+    // Add the indices [begin, end), which must not precede the last index of the bitmap.
+    void append(std::size_t begin, std::size_t end);
+    inline void set(std::size_t index) { append(index, index + 1); }
+
+    [[nodiscard]] inline const std::vector<run>& runs() const noexcept { return runs_; }
+    [[nodiscard]] inline bool empty() const noexcept { return runs_.empty(); }
+    [[nodiscard]] std::size_t count() const noexcept;
+    [[nodiscard]] bool test(std::size_t index) const noexcept;
+    [[nodiscard]] inline std::optional<std::size_t> highest_set() const noexcept
+    {
+        return runs_.empty() ? std::nullopt : std::optional<std::size_t>(runs_.back().end - 1);
+    }
+    [[nodiscard]] inline std::optional<std::size_t> lowest_set() const noexcept
+    {
+        return runs_.empty() ? std::nullopt : std::optional<std::size_t>(runs_.front().begin);
+    }
+
+    // Call `function(std::size_t)` for each index, in ascending order.
+    template <class Function>
+    void for_each(Function&& function) const
+    {
+        for (const run& indices : runs_)
+        {
+            for (std::size_t index = indices.begin; index < indices.end; ++index)
+                function(index);
+        }
+    }
+
+    friend version_bitmap operator&(const version_bitmap& lhs, const version_bitmap& rhs);
+    friend version_bitmap operator|(const version_bitmap& lhs, const version_bitmap& rhs);
+    // Indices of `lhs` which are not in `rhs`.
+    friend version_bitmap and_not(const version_bitmap& lhs, const version_bitmap& rhs);
+
+    inline version_bitmap& operator&=(const version_bitmap& other) { return *this = *this & other; }
+    inline version_bitmap& operator|=(const version_bitmap& other) { return *this = *this | other; }
+
+    bool operator==(const version_bitmap&) const = default;
+
+private:
+    std::vector<run> runs_;
+};
+
+inline void version_bitmap::append(std::size_t begin, std::size_t end)
+{
+    if (begin >= end)
+        return;
+    if (!runs_.empty())
+    {
+        run& last = runs_.back();
+        if (begin < last.end) [[unlikely]]
+            throw std::invalid_argument("Indices must be appended in ascending order.");
+        if (begin == last.end)
+        {
+            last.end = end;
+            return;
+        }
+    }
+    runs_.push_back({ begin, end });
+}
+
+inline std::size_t version_bitmap::count() const noexcept
+{
+    std::size_t count = 0;
+    for (const run& indices : runs_)
+        count += indices.end - indices.begin;
+    return count;
+}
+
+inline bool version_bitmap::test(std::size_t index) const noexcept
+{
+    const auto iter =
+        std::partition_point(runs_.begin(), runs_.end(), [index](const run& indices) { return indices.end <= index; });
+    return iter != runs_.end() && iter->begin <= index;
+}
+
+inline version_bitmap operator&(const version_bitmap& lhs, const version_bitmap& rhs)
+{
+    version_bitmap result;
+    auto liter = lhs.runs_.begin();
+    auto riter = rhs.runs_.begin();
+    while (liter != lhs.runs_.end() && riter != rhs.runs_.end())
+    {
+        result.append(std::max(liter->begin, riter->begin), std::min(liter->end, riter->end));
+        if (liter->end < riter->end)
+            ++liter;
+        else
+            ++riter;
+    }
+    return result;
+}
+
+inline version_bitmap operator|(const version_bitmap& lhs, const version_bitmap& rhs)
+{
+    version_bitmap result;
+    auto liter = lhs.runs_.begin();
+    auto riter = rhs.runs_.begin();
+    while (liter != lhs.runs_.end() || riter != rhs.runs_.end())
+    {
+        const bool take_left =
+            riter == rhs.runs_.end() || (liter != lhs.runs_.end() && liter->begin <= riter->begin);
+        const version_bitmap::run& indices = take_left ? *liter++ : *riter++;
+        if (!result.runs_.empty() && indices.begin <= result.runs_.back().end)
+            result.runs_.back().end = std::max(result.runs_.back().end, indices.end);
+        else
+            result.runs_.push_back(indices);
+    }
+    return result;
+}
+
+inline version_bitmap and_not(const version_bitmap& lhs, const version_bitmap& rhs)
+{
+    version_bitmap result;
+    auto riter = rhs.runs_.begin();
+    for (const version_bitmap::run& indices : lhs.runs_)
+    {
+        std::size_t begin = indices.begin;
+        while (riter != rhs.runs_.end() && riter->end <= begin)
+            ++riter;
+        for (auto iter = riter; iter != rhs.runs_.end() && iter->begin < indices.end; ++iter)
+        {
+            result.append(begin, iter->begin);
+            begin = std::max(begin, iter->end);
+        }
+        result.append(begin, indices.end);
+    }
+    return result;
+}
+
+} // namespace vrsn
+} // namespace arba
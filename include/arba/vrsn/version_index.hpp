@@ -0,0 +1,156 @@
+#pragma once
+
+#include "range_set.hpp"
+#include "version_bitmap.hpp"
+
+#include <algorithm>
+#include <list>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+inline namespace arba
+{
+namespace vrsn
+{
+
+// Sorted version array on which version ranges are evaluated as bitmaps of indices, with two binary searches per
+// interval. Multi-constraint queries are then bitmap combinations, without any further version comparison.
+class version_index
+{
+public:
+    explicit version_index(std::vector<semver> versions);
+
+    [[nodiscard]] inline std::span<const semver> versions() const noexcept { return versions_; }
+    [[nodiscard]] inline std::size_t size() const noexcept { return versions_.size(); }
+    [[nodiscard]] inline const semver& operator[](std::size_t index) const { return versions_[index]; }
+
+    [[nodiscard]] inline version_bitmap all() const { return version_bitmap::range(0, versions_.size()); }
+    [[nodiscard]] version_bitmap evaluate(const range_set& set) const;
+    [[nodiscard]] inline version_bitmap evaluate(const version_range& range) const
+    {
+        return evaluate(range_set(range));
+    }
+    [[nodiscard]] inline version_bitmap compatible_with(const Numver auto& version, compatibility policy) const
+    {
+        return evaluate(range_set::compatible_with(version, policy));
+    }
+    // Versions for which `pred` is true, for predicates which are not ranges.
+    template <class Predicate>
+    [[nodiscard]] version_bitmap evaluate_if(Predicate pred) const
+    {
+        version_bitmap bitmap;
+        for (std::size_t index = 0; index < versions_.size(); ++index)
+        {
+            if (pred(versions_[index]))
+                bitmap.set(index);
+        }
+        return bitmap;
+    }
+
+    // Greatest version of `bitmap`, or nullptr if it is empty.
+    [[nodiscard]] inline const semver* highest(const version_bitmap& bitmap) const
+    {
+        const std::optional<std::size_t> index = bitmap.highest_set();
+        return index ? &versions_[*index] : nullptr;
+    }
+
+private:
+    std::vector<semver> versions_;
+};
+
+inline version_index::version_index(std::vector<semver> versions) : versions_(std::move(versions))
+{
+    std::stable_sort(versions_.begin(), versions_.end());
+}
+
+inline version_bitmap version_index::evaluate(const range_set& set) const
+{
+    version_bitmap bitmap;
+    for (const version_range& interval : set.intervals())
+    {
+        const auto first = interval.lower() ? std::lower_bound(versions_.begin(), versions_.end(), *interval.lower())
+                                            : versions_.begin();
+        const auto last =
+            interval.upper() ? std::lower_bound(first, versions_.end(), *interval.upper()) : versions_.end();
+        bitmap.append(first - versions_.begin(), last - versions_.begin());
+    }
+    return bitmap;
+}
+
+// Least recently used cache of the bitmaps of a version_index, for the ranges evaluated again and again.
+// It is not thread-safe.
+class version_bitmap_cache
+{
+public:
+    // The index must outlive the cache.
+    version_bitmap_cache(const version_index& index, std::size_t capacity);
+
+    [[nodiscard]] std::shared_ptr<const version_bitmap> evaluate(const range_set& set);
+    [[nodiscard]] inline std::shared_ptr<const version_bitmap> compatible_with(const Numver auto& version,
+                                                                               compatibility policy)
+    {
+        return evaluate(range_set::compatible_with(version, policy));
+    }
+
+    [[nodiscard]] inline const version_index& index() const noexcept { return index_; }
+    [[nodiscard]] inline std::size_t size() const noexcept { return entries_.size(); }
+    [[nodiscard]] inline std::size_t capacity() const noexcept { return capacity_; }
+    [[nodiscard]] inline std::size_t hit_count() const noexcept { return hit_count_; }
+    [[nodiscard]] inline std::size_t miss_count() const noexcept { return miss_count_; }
+    inline void clear()
+    {
+        entries_.clear();
+        positions_.clear();
+    }
+
+private:
+    struct entry
+    {
+        std::string key; // canonical form of the range set
+        std::shared_ptr<const version_bitmap> bitmap;
+    };
+
+    const version_index& index_;
+    std::size_t capacity_;
+    std::list<entry> entries_; // most recently used first
+    std::unordered_map<std::string, std::list<entry>::iterator> positions_;
+    std::size_t hit_count_ = 0;
+    std::size_t miss_count_ = 0;
+};
+
+inline version_bitmap_cache::version_bitmap_cache(const version_index& index, std::size_t capacity)
+    : index_(index), capacity_(capacity)
+{
+    if (capacity == 0)
+        throw std::invalid_argument("The capacity of a cache must not be zero.");
+}
+
+inline std::shared_ptr<const version_bitmap> version_bitmap_cache::evaluate(const range_set& set)
+{
+    std::string key = set.to_string();
+    if (auto iter = positions_.find(key); iter != positions_.end())
+    {
+        ++hit_count_;
+        entries_.splice(entries_.begin(), entries_, iter->second);
+        return iter->second->bitmap;
+    }
+
+    ++miss_count_;
+    auto bitmap = std::make_shared<const version_bitmap>(index_.evaluate(set));
+    if (entries_.size() == capacity_)
+    {
+        positions_.erase(entries_.back().key);
+        entries_.pop_back();
+    }
+    entries_.push_front({ key, bitmap });
+    positions_.emplace(std::move(key), entries_.begin());
+    return bitmap;
+}
+
+} // namespace vrsn
+} // namespace arba
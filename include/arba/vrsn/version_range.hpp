@@ -0,0 +1,156 @@
+#pragma once
+
+#include "is_compatible_with.hpp"
+#include "semver.hpp"
+
+#include <format>
+#include <limits>
+#include <optional>
+#include <string>
+
+inline namespace arba
+{
+namespace vrsn
+{
+
+// Interval of semantic versions ordered by precedence. A missing bound means the interval is unbounded on that side.
+class version_range
+{
+public:
+    // Any version.
+    version_range() = default;
+    version_range(std::optional<semver> lower, bool lower_inclusive, std::optional<semver> upper,
+                  bool upper_inclusive);
+
+    [[nodiscard]] inline static version_range exact(const semver& version)
+    {
+        return version_range(version, true, version, true);
+    }
+    [[nodiscard]] inline static version_range at_least(const semver& version)
+    {
+        return version_range(version, true, std::nullopt, false);
+    }
+    [[nodiscard]] inline static version_range greater_than(const semver& version)
+    {
+        return version_range(version, false, std::nullopt, false);
+    }
+    [[nodiscard]] inline static version_range at_most(const semver& version)
+    {
+        return version_range(std::nullopt, false, version, true);
+    }
+    [[nodiscard]] inline static version_range less_than(const semver& version)
+    {
+        return version_range(std::nullopt, false, version, false);
+    }
+    // [lower, upper)
+    [[nodiscard]] inline static version_range between(const semver& lower, const semver& upper)
+    {
+        return version_range(lower, true, upper, false);
+    }
+    // The versions v for which is_compatible_with(v, version, policy) is true, pre-releases included:
+    // compatible_with(1.2.3, major) is [1.2.3-0, 2.0.0-0).
+    [[nodiscard]] static version_range compatible_with(const Numver auto& version, compatibility policy);
+
+    inline const std::optional<semver>& lower() const noexcept { return lower_; }
+    inline bool lower_inclusive() const noexcept { return lower_inclusive_; }
+    inline const std::optional<semver>& upper() const noexcept { return upper_; }
+    inline bool upper_inclusive() const noexcept { return upper_inclusive_; }
+
+    [[nodiscard]] inline bool contains(const semver& version) const
+    {
+        return !is_below_(version) && !is_above_(version);
+    }
+    [[nodiscard]] bool is_empty() const;
+    [[nodiscard]] inline bool is_any() const noexcept { return !lower_ && !upper_; }
+
+    // "*", "=1.2.3", ">=1.2.3 <2.0.0-0", ...
+    [[nodiscard]] std::string to_string() const;
+
+    bool operator==(const version_range&) const = default;
+
+private:
+    inline bool is_below_(const semver& version) const
+    {
+        return lower_ && (lower_inclusive_ ? version < *lower_ : version <= *lower_);
+    }
+    inline bool is_above_(const semver& version) const
+    {
+        return upper_ && (upper_inclusive_ ? *upper_ < version : *upper_ <= version);
+    }
+
+private:
+    std::optional<semver> lower_;
+    bool lower_inclusive_ = false;
+    std::optional<semver> upper_;
+    bool upper_inclusive_ = false;
+};
+
+inline version_range::version_range(std::optional<semver> lower, bool lower_inclusive, std::optional<semver> upper,
+                                    bool upper_inclusive)
+    : lower_(std::move(lower)), lower_inclusive_(lower_ && lower_inclusive), upper_(std::move(upper)),
+      upper_inclusive_(upper_ && upper_inclusive)
+{
+}
+
+version_range version_range::compatible_with(const Numver auto& version, compatibility policy)
+{
+    const uint64_t major = version.major();
+    const uint32_t minor = version.minor();
+    const uint32_t patch = version.patch();
+    // The lowest pre-release of a version core precedes all the versions having this core.
+    const semver lower(numver(major, minor, patch), "0");
+
+    std::optional<semver> upper;
+    const auto next_major = [&]
+    {
+        if (major != std::numeric_limits<uint64_t>::max())
+            upper.emplace(numver(major + 1, 0, 0), "0");
+    };
+    const auto next_minor = [&]
+    {
+        if (minor != std::numeric_limits<uint32_t>::max())
+            upper.emplace(numver(major, minor + 1, 0), "0");
+        else
+            next_major();
+    };
+    switch (policy)
+    {
+    case compatibility::major:
+        next_major();
+        break;
+    case compatibility::minor:
+        next_minor();
+        break;
+    case compatibility::patch:
+        if (patch != std::numeric_limits<uint32_t>::max())
+            upper.emplace(numver(major, minor, patch + 1), "0");
+        else
+            next_minor();
+        break;
+    }
+    return version_range(lower, true, std::move(upper), false);
+}
+
+inline bool version_range::is_empty() const
+{
+    if (!lower_ || !upper_)
+        return false;
+    return *upper_ < *lower_ || (*upper_ == *lower_ && !(lower_inclusive_ && upper_inclusive_));
+}
+
+inline std::string version_range::to_string() const
+{
+    if (is_any())
+        return "*";
+    if (lower_ && upper_ && lower_inclusive_ && upper_inclusive_ && *lower_ == *upper_)
+        return std::format("={}", *lower_);
+    std::string str;
+    if (lower_)
+        str = std::format("{}{}", lower_inclusive_ ? ">=" : ">", *lower_);
+    if (upper_)
+        str += std::format("{}{}{}", lower_ ? " " : "", upper_inclusive_ ? "<=" : "<", *upper_);
+    return str;
+}
+
+} // namespace vrsn
+} // namespace arba
@@ -0,0 +1,184 @@
+#pragma once
+
+#include "concepts/numver.hpp"
+#include "is_compatible_with.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+inline namespace arba
+{
+namespace vrsn
+{
+// Flat associative container sorted by version (numver or semver keys).
+// Lookups are binary searches over contiguous storage.
+template <Numver Key, class T>
+class versioned_map
+{
+public:
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = std::pair<Key, T>;
+    using container_type = std::vector<value_type>;
+    using size_type = typename container_type::size_type;
+    using iterator = typename container_type::iterator;
+    using const_iterator = typename container_type::const_iterator;
+
+    versioned_map() = default;
+
+    // Sort and deduplicate unsorted input. When several entries share the same key, the first one is kept.
+    [[nodiscard]] static versioned_map build(container_type values);
+
+    inline const_iterator begin() const noexcept { return values_.begin(); }
+    inline const_iterator end() const noexcept { return values_.end(); }
+    inline iterator begin() noexcept { return values_.begin(); }
+    inline iterator end() noexcept { return values_.end(); }
+    inline size_type size() const noexcept { return values_.size(); }
+    inline bool empty() const noexcept { return values_.empty(); }
+    inline void clear() noexcept { values_.clear(); }
+    inline void reserve(size_type capacity) { values_.reserve(capacity); }
+
+    std::pair<iterator, bool> insert_or_assign(const key_type& key, mapped_type value);
+    bool erase(const key_type& key);
+
+    // Entry whose key is equal to `version`, or end().
+    [[nodiscard]] const_iterator find_exact(const key_type& version) const;
+    // Entry with the greatest key less than or equal to `version`, or end().
+    [[nodiscard]] const_iterator find_floor(const key_type& version) const;
+    // Entry with the greatest key major-compatible with `version`, or end().
+    [[nodiscard]] const_iterator find_best_major_compatible(const Numver auto& version) const;
+    // Entry with the greatest key minor-compatible with `version`, or end().
+    [[nodiscard]] const_iterator find_best_minor_compatible(const Numver auto& version) const;
+
+    inline iterator find_exact(const key_type& version)
+    {
+        return to_mutable_(std::as_const(*this).find_exact(version));
+    }
+    inline iterator find_floor(const key_type& version)
+    {
+        return to_mutable_(std::as_const(*this).find_floor(version));
+    }
+    inline iterator find_best_major_compatible(const Numver auto& version)
+    {
+        return to_mutable_(std::as_const(*this).find_best_major_compatible(version));
+    }
+    inline iterator find_best_minor_compatible(const Numver auto& version)
+    {
+        return to_mutable_(std::as_const(*this).find_best_minor_compatible(version));
+    }
+
+private:
+    inline const_iterator lower_bound_(const key_type& version) const
+    {
+        return std::partition_point(values_.begin(), values_.end(),
+                                    [&](const value_type& entry) { return entry.first < version; });
+    }
+
+    // Last entry satisfying `is_not_past`, if it is compatible with `version`.
+    template <class NotPastPredicate, class CompatiblePredicate>
+    const_iterator find_best_compatible_(const Numver auto& version, NotPastPredicate is_not_past,
+                                         CompatiblePredicate is_compatible) const;
+
+    inline iterator to_mutable_(const_iterator iter) { return values_.begin() + (iter - values_.cbegin()); }
+
+private:
+    container_type values_;
+};
+
+template <Numver Key, class T>
+versioned_map<Key, T> versioned_map<Key, T>::build(container_type values)
+{
+    std::stable_sort(values.begin(), values.end(),
+                     [](const value_type& lhs, const value_type& rhs) { return lhs.first < rhs.first; });
+    auto last_iter = std::unique(values.begin(), values.end(),
+                                 [](const value_type& lhs, const value_type& rhs)
+                                 { return !(lhs.first < rhs.first) && !(rhs.first < lhs.first); });
+    values.erase(last_iter, values.end());
+
+    versioned_map map;
+    map.values_ = std::move(values);
+    return map;
+}
+
+template <Numver Key, class T>
+std::pair<typename versioned_map<Key, T>::iterator, bool>
+versioned_map<Key, T>::insert_or_assign(const key_type& key, mapped_type value)
+{
+    iterator iter = to_mutable_(lower_bound_(key));
+    if (iter != values_.end() && !(key < iter->first))
+    {
+        iter->second = std::move(value);
+        return { iter, false };
+    }
+    return { values_.emplace(iter, key, std::move(value)), true };
+}
+
+template <Numver Key, class T>
+bool versioned_map<Key, T>::erase(const key_type& key)
+{
+    const_iterator iter = find_exact(key);
+    if (iter == values_.end())
+        return false;
+    values_.erase(iter);
+    return true;
+}
+
+template <Numver Key, class T>
+typename versioned_map<Key, T>::const_iterator versioned_map<Key, T>::find_exact(const key_type& version) const
+{
+    const_iterator iter = lower_bound_(version);
+    if (iter != values_.end() && !(version < iter->first))
+        return iter;
+    return values_.end();
+}
+
+template <Numver Key, class T>
+typename versioned_map<Key, T>::const_iterator versioned_map<Key, T>::find_floor(const key_type& version) const
+{
+    const_iterator iter = std::partition_point(values_.begin(), values_.end(),
+                                               [&](const value_type& entry) { return !(version < entry.first); });
+    if (iter == values_.begin())
+        return values_.end();
+    return std::prev(iter);
+}
+
+template <Numver Key, class T>
+template <class NotPastPredicate, class CompatiblePredicate>
+typename versioned_map<Key, T>::const_iterator
+versioned_map<Key, T>::find_best_compatible_(const Numver auto& version, NotPastPredicate is_not_past,
+                                             CompatiblePredicate is_compatible) const
+{
+    const_iterator iter = std::partition_point(values_.begin(), values_.end(),
+                                               [&](const value_type& entry) { return is_not_past(entry.first); });
+    if (iter == values_.begin())
+        return values_.end();
+    --iter;
+    if (is_compatible(iter->first, version))
+        return iter;
+    return values_.end();
+}
+
+template <Numver Key, class T>
+typename versioned_map<Key, T>::const_iterator
+versioned_map<Key, T>::find_best_major_compatible(const Numver auto& version) const
+{
+    return find_best_compatible_(
+        version, [&](const key_type& key) { return key.major() <= static_cast<uint64_t>(version.major()); },
+        [](const key_type& lv, const auto& rv) { return vrsn::is_major_compatible_with(lv, rv); });
+}
+
+template <Numver Key, class T>
+typename versioned_map<Key, T>::const_iterator
+versioned_map<Key, T>::find_best_minor_compatible(const Numver auto& version) const
+{
+    return find_best_compatible_(
+        version,
+        [&, major = static_cast<uint64_t>(version.major()), minor = static_cast<uint32_t>(version.minor())](
+            const key_type& key) { return key.major() < major || (key.major() == major && key.minor() <= minor); },
+        [](const key_type& lv, const auto& rv) { return vrsn::is_minor_compatible_with(lv, rv); });
+}
+
+} // namespace vrsn
+} // namespace arba
@@ -2,13 +2,36 @@
 
 #include "is_compatible_with.hpp"
 
+#include <arba/vrsn/string/to_chars.hpp>
+#include <array>
 #include <cstdint>
+#include <string_view>
 #include <tuple>
 
 inline namespace arba
 {
 namespace vrsn
 {
+namespace private_
+{
+
+// "Major.Minor.Patch" as a null-terminated array, built at compile time.
+template <uint64_t Major, uint32_t Minor, uint32_t Patch>
+inline constexpr auto vtag_chars_ = []
+{
+    constexpr std::size_t major_digits = count_digits_(Major);
+    constexpr std::size_t minor_digits = count_digits_(Minor);
+    constexpr std::size_t patch_digits = count_digits_(Patch);
+    std::array<char, major_digits + minor_digits + patch_digits + 3> chars{};
+    char* iter = write_digits_(chars.data(), Major, major_digits);
+    *iter++ = '.';
+    iter = write_digits_(iter, Minor, minor_digits);
+    *iter++ = '.';
+    write_digits_(iter, Patch, patch_digits);
+    return chars;
+}();
+
+} // namespace private_
 
 template <uint64_t Major, uint32_t Minor, uint32_t Patch>
 class vtag
@@ -24,6 +47,13 @@ public:
 
     inline constexpr tuple_type to_tuple() const noexcept { return tuple_type(Major, Minor, Patch); }
 
+    // "Major.Minor.Patch", stored in static memory and null-terminated.
+    inline static constexpr std::string_view to_string_view() noexcept
+    {
+        constexpr const auto& chars = private_::vtag_chars_<Major, Minor, Patch>;
+        return std::string_view(chars.data(), chars.size() - 1);
+    }
+
     inline constexpr bool is_major_compatible_with(const Numver auto& rv) const noexcept
     {
         return vrsn::is_major_compatible_with(*this, rv);
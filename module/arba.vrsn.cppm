@@ -0,0 +1,71 @@
+// Named module exporting the version vocabulary of arba-vrsn: numver, basic_numver, semver, semver_view, vtag,
+// versioned_map, the compatibility checks, the formatting and binary encoding functions, and the instrumentation
+// snapshot.
+// Importing it avoids parsing the library headers and their standard headers in every translation unit.
+// The heavier components (catalogs, resolver, pipelines, ...) are used through their headers.
+
+module;
+
+#include <arba/vrsn/basic_numver.hpp>
+#include <arba/vrsn/binary_encoding.hpp>
+#include <arba/vrsn/semver_view.hpp>
+#include <arba/vrsn/stats.hpp>
+#include <arba/vrsn/versioned_map.hpp>
+#include <arba/vrsn/vtag.hpp>
+#include <cstdint>
+#include <format>
+
+export module arba.vrsn;
+
+export namespace arba::vrsn
+{
+// concepts
+using arba::vrsn::Numver;
+using arba::vrsn::Semver;
+
+// compatibility
+using arba::vrsn::compatibility;
+using arba::vrsn::is_compatible_with;
+using arba::vrsn::is_major_compatible_with;
+using arba::vrsn::is_minor_compatible_with;
+using arba::vrsn::is_patch_compatible_with;
+
+// versions
+using arba::vrsn::basic_numver;
+using arba::vrsn::numver;
+using arba::vrsn::semver;
+using arba::vrsn::semver_view;
+using arba::vrsn::versioned_map;
+using arba::vrsn::vtag;
+
+// conversions
+using arba::vrsn::max_formatted_size;
+using arba::vrsn::stoi64;
+using arba::vrsn::to_chars;
+
+// binary encoding
+using arba::vrsn::binary_result;
+using arba::vrsn::decode_from;
+using arba::vrsn::encode_to;
+using arba::vrsn::encoded_size;
+using arba::vrsn::max_encoded_numver_size;
+
+// instrumentation
+using arba::vrsn::stat_counter;
+using arba::vrsn::stat_counter_count;
+using arba::vrsn::stat_counter_name;
+using arba::vrsn::stats_enabled;
+using arba::vrsn::stats_snapshot;
+using arba::vrsn::stats_timing_enabled;
+using arba::vrsn::take_stats_snapshot;
+} // namespace arba::vrsn
+
+// The std::formatter specializations are declared in the global module fragment: naming them in the purview keeps
+// them reachable from the importers, so that std::format accepts the exported versions.
+namespace arba::vrsn::private_
+{
+using numver_formatter_ = std::formatter<numver, char>;
+using basic_numver_formatter_ = std::formatter<basic_numver<uint32_t, 3>, char>;
+using semver_formatter_ = std::formatter<semver, char>;
+using semver_view_formatter_ = std::formatter<semver_view, char>;
+} // namespace arba::vrsn::private_
@@ -0,0 +1,86 @@
+#include <arba/vrsn/atomic_numver.hpp>
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+TEST(atomic_numver_tests, constructor__default__same_as_numver)
+{
+    vrsn::atomic_numver version;
+    ASSERT_EQ(version.load(), vrsn::numver());
+}
+
+TEST(atomic_numver_tests, fetch_up__nominal_case__same_as_numver_up)
+{
+    vrsn::atomic_numver version(vrsn::numver(1, 2, 3));
+    ASSERT_EQ(version.fetch_up_patch(), vrsn::numver(1, 2, 3));
+    ASSERT_EQ(version.load(), vrsn::numver(1, 2, 4));
+    ASSERT_EQ(version.fetch_up_minor(), vrsn::numver(1, 2, 4));
+    ASSERT_EQ(version.load(), vrsn::numver(1, 3, 0));
+    version.store(vrsn::numver(1, 3, 7));
+    ASSERT_EQ(version.fetch_up_major(), vrsn::numver(1, 3, 7));
+    ASSERT_EQ(version.load(), vrsn::numver(2, 0, 0));
+}
+
+TEST(atomic_numver_tests, compare_exchange__nominal_case__expected_updated_on_failure)
+{
+    vrsn::atomic_numver version(vrsn::numver(1, 0, 0));
+    vrsn::numver expected(0, 9, 0);
+    ASSERT_FALSE(version.compare_exchange(expected, vrsn::numver(2, 0, 0)));
+    ASSERT_EQ(expected, vrsn::numver(1, 0, 0));
+    ASSERT_TRUE(version.compare_exchange(expected, vrsn::numver(2, 0, 0)));
+    ASSERT_EQ(version.exchange(vrsn::numver(3, 0, 0)), vrsn::numver(2, 0, 0));
+    ASSERT_EQ(static_cast<vrsn::numver>(version), vrsn::numver(3, 0, 0));
+}
+
+TEST(atomic_numver_tests, fetch_up_patch__concurrent_threads__no_lost_update)
+{
+    constexpr unsigned thread_count = 8;
+    constexpr unsigned increment_count = 10000;
+    vrsn::atomic_numver version(vrsn::numver(1, 0, 0));
+    std::atomic<bool> torn_read{ false };
+    {
+        std::vector<std::jthread> threads;
+        for (unsigned i = 0; i < thread_count; ++i)
+        {
+            threads.emplace_back(
+                [&]
+                {
+                    for (unsigned j = 0; j < increment_count; ++j)
+                    {
+                        version.fetch_up_patch();
+                        if (version.load().major() != 1)
+                            torn_read = true;
+                    }
+                });
+        }
+    }
+    ASSERT_FALSE(torn_read);
+    ASSERT_EQ(version.load(), vrsn::numver(1, 0, thread_count * increment_count));
+}
+
+TEST(atomic_numver_tests, load__concurrent_up_minor__consistent_versions)
+{
+    vrsn::atomic_numver version(vrsn::numver(0, 0, 0));
+    std::atomic<bool> done{ false };
+    std::atomic<bool> inconsistent{ false };
+    std::jthread reader(
+        [&]
+        {
+            while (!done)
+            {
+                // The writer sets the patch to the minor before each up_minor().
+                const vrsn::numver value = version.load();
+                if (value.patch() != 0 && value.patch() != value.minor())
+                    inconsistent = true;
+            }
+        });
+    for (uint32_t i = 0; i < 20000; ++i)
+    {
+        version.store(vrsn::numver(0, i, i));
+        version.fetch_up_minor();
+    }
+    done = true;
+    reader.join();
+    ASSERT_FALSE(inconsistent);
+}
@@ -0,0 +1,99 @@
+#include <arba/vrsn/basic_numver.hpp>
+#include <arba/vrsn/numver.hpp>
+#include <arba/vrsn/semver.hpp>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+using numver16 = vrsn::basic_numver<uint16_t, 3>;
+using numver4 = vrsn::basic_numver<uint32_t, 4>;
+
+static_assert(sizeof(numver16) == 6);
+static_assert(sizeof(vrsn::basic_numver<uint16_t, 4>) == 8);
+static_assert(sizeof(numver4) == 16);
+static_assert(vrsn::Numver<numver16> && vrsn::Numver<numver4>);
+static_assert(numver16("1.2.3") == numver16(1, 2, 3));
+static_assert(numver4("1.2.3.4") < numver4(1, 2, 3, 5));
+static_assert(numver16() == numver16(0, 1, 0));
+
+TEST(basic_numver_tests, constructor__string__ok)
+{
+    const numver4 version("10.0.65536.4294967295");
+    ASSERT_EQ(version.major(), 10);
+    ASSERT_EQ(version.minor(), 0);
+    ASSERT_EQ(version.patch(), 65536);
+    ASSERT_EQ(version[3], 4294967295u);
+    ASSERT_EQ(numver16("65535.0.7").major(), 65535);
+}
+
+TEST(basic_numver_tests, constructor__invalid_string__invalid_argument)
+{
+    for (std::string_view str : { "", "1.2", "1.2.3.4", "01.2.3", "1.2.3-rc", "1..3", "1.2.3." })
+        ASSERT_THROW(numver16{ str }, std::invalid_argument) << str;
+    ASSERT_THROW(numver4("1.2.3"), std::invalid_argument);
+}
+
+TEST(basic_numver_tests, constructor__too_large_number__out_of_range)
+{
+    ASSERT_THROW(numver16("65536.0.0"), std::out_of_range);
+    ASSERT_THROW(numver16("1.2.100000"), std::out_of_range);
+    ASSERT_THROW(numver4("1.2.3.99999999999999999999999"), std::out_of_range);
+    ASSERT_THROW(numver16(1, 70000, 0), std::out_of_range);
+    ASSERT_THROW(numver16(-1, 0, 0), std::out_of_range);
+}
+
+TEST(basic_numver_tests, conversions__checked)
+{
+    const numver16 small(vrsn::numver(1, 2, 3));
+    ASSERT_EQ(small, numver16(1, 2, 3));
+    ASSERT_EQ(vrsn::numver(small), vrsn::numver(1, 2, 3));
+    ASSERT_EQ(numver4(small), numver4(1, 2, 3, 0));
+    ASSERT_EQ(numver16(numver4(1, 2, 3, 0)), small);
+    ASSERT_EQ(numver16(vrsn::semver("1.2.3-rc.1")), small);
+
+    ASSERT_THROW(numver16(numver4(1, 2, 3, 4)), std::out_of_range);
+    ASSERT_THROW(numver16(vrsn::numver(1, 2, 100000)), std::out_of_range);
+    ASSERT_THROW(numver16(numver4(1, 2, 65536, 0)), std::out_of_range);
+}
+
+TEST(basic_numver_tests, comparison__component_by_component)
+{
+    std::vector<numver4> versions{ numver4(1, 10, 0, 0), numver4(1, 2, 0, 10), numver4(1, 2, 0, 9),
+                                   numver4(0, 99, 99, 99) };
+    std::ranges::sort(versions);
+    ASSERT_EQ(versions, (std::vector{ numver4(0, 99, 99, 99), numver4(1, 2, 0, 9), numver4(1, 2, 0, 10),
+                                      numver4(1, 10, 0, 0) }));
+    ASSERT_NE(numver16(1, 2, 3), numver16(1, 2, 4));
+}
+
+TEST(basic_numver_tests, compatibility__ok)
+{
+    const numver16 version(1, 4, 2);
+    ASSERT_TRUE(version.is_major_compatible_with(vrsn::numver(1, 2, 0)));
+    ASSERT_FALSE(version.is_minor_compatible_with(numver16(1, 2, 0)));
+    ASSERT_TRUE(vrsn::is_compatible_with(vrsn::numver(1, 4, 5), version, vrsn::compatibility::minor));
+}
+
+TEST(basic_numver_tests, up__following_components_reset)
+{
+    numver4 version(1, 2, 3, 4);
+    version.up(3);
+    ASSERT_EQ(version, numver4(1, 2, 3, 5));
+    version.up_minor();
+    ASSERT_EQ(version, numver4(1, 3, 0, 0));
+    version.up_major();
+    ASSERT_EQ(version, numver4(2, 0, 0, 0));
+}
+
+TEST(basic_numver_tests, format__ok)
+{
+    ASSERT_EQ(std::format("{}", numver4(1, 2, 3, 4)), "1.2.3.4");
+    ASSERT_EQ(std::format("{}", numver16(65535, 65535, 65535)), "65535.65535.65535");
+    char buffer[9];
+    const std::to_chars_result res = vrsn::to_chars(std::begin(buffer), std::end(buffer), numver4(1, 22, 3, 40));
+    ASSERT_EQ(res.ec, std::errc{});
+    ASSERT_EQ(std::string_view(buffer, res.ptr), "1.22.3.40");
+    ASSERT_EQ(vrsn::to_chars(std::begin(buffer), std::end(buffer), numver4(1, 22, 3, 400)).ec,
+              std::errc::value_too_large);
+}
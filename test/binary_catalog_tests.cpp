@@ -0,0 +1,95 @@
+#include <arba/vrsn/binary_catalog.hpp>
+#include <arba/vrsn/io/mapped_file.hpp>
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <vector>
+
+namespace
+{
+
+vrsn::binary_catalog_writer make_writer()
+{
+    vrsn::binary_catalog_writer writer;
+    writer.add("zlib", vrsn::semver("1.3.1"));
+    writer.add("arba-vrsn", vrsn::semver("0.4.1"));
+    writer.add("arba-vrsn", vrsn::semver("0.4.0-rc.1+20240101"));
+    writer.add("arba-vrsn", vrsn::semver("0.2.0"));
+    writer.add("fmt", vrsn::semver("10.2.1"));
+    writer.add("fmt", vrsn::semver("11.0.0-alpha.1"));
+    return writer;
+}
+
+} // namespace
+
+TEST(binary_catalog_tests, round_trip__bytes__same_versions)
+{
+    const std::vector<std::byte> bytes = make_writer().to_bytes();
+    const vrsn::binary_catalog_view catalog(bytes);
+    ASSERT_EQ(catalog.package_count(), 3);
+    ASSERT_EQ(catalog.entry_count(), 6);
+    ASSERT_EQ(catalog.package(0).name(), "arba-vrsn");
+
+    const auto package = catalog.find("arba-vrsn");
+    ASSERT_TRUE(package.has_value());
+    ASSERT_EQ(package->size(), 3);
+    ASSERT_EQ((*package)[0], vrsn::semver_view("0.2.0"));
+    ASSERT_EQ((*package)[1].pre_release(), "rc.1");
+    ASSERT_EQ((*package)[1].build_metadata(), "20240101");
+    ASSERT_EQ(package->back().to_semver(), vrsn::semver("0.4.1"));
+
+    std::vector<vrsn::semver> fmt_versions;
+    const auto fmt_package = catalog.find("fmt");
+    ASSERT_TRUE(fmt_package.has_value());
+    for (vrsn::semver_view version : *fmt_package)
+        fmt_versions.push_back(version.to_semver());
+    ASSERT_EQ(fmt_versions, (std::vector<vrsn::semver>{ vrsn::semver("10.2.1"), vrsn::semver("11.0.0-alpha.1") }));
+}
+
+TEST(binary_catalog_tests, find__unknown_package__nullopt)
+{
+    const std::vector<std::byte> bytes = make_writer().to_bytes();
+    const vrsn::binary_catalog_view catalog(bytes);
+    ASSERT_FALSE(catalog.find("boost").has_value());
+    ASSERT_FALSE(catalog.find("").has_value());
+    ASSERT_FALSE(catalog.find("zzz").has_value());
+}
+
+TEST(binary_catalog_tests, package_view__catalog_view_out_of_scope__valid)
+{
+    const std::vector<std::byte> bytes = make_writer().to_bytes();
+    const vrsn::binary_catalog_view::package_view package = vrsn::binary_catalog_view(bytes).package(0);
+    vrsn::binary_catalog_view::package_view::iterator iter;
+    {
+        const vrsn::binary_catalog_view catalog(bytes);
+        iter = catalog.find("fmt")->begin();
+    }
+    ASSERT_EQ(package.name(), "arba-vrsn");
+    ASSERT_EQ(package.size(), 3);
+    ASSERT_EQ(package.back(), vrsn::semver_view("0.4.1"));
+    ASSERT_EQ(std::vector<vrsn::semver_view>(package.begin(), package.end()).front(), vrsn::semver_view("0.2.0"));
+    ASSERT_EQ(*iter, vrsn::semver_view("10.2.1"));
+    ASSERT_EQ(*++iter, vrsn::semver_view("11.0.0-alpha.1"));
+}
+
+TEST(binary_catalog_tests, round_trip__mapped_file__same_versions)
+{
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "arba_vrsn_binary_catalog_tests.bin";
+    make_writer().write(path);
+    {
+        const vrsn::mapped_file file(path);
+        const vrsn::binary_catalog_view catalog(file.bytes());
+        const auto package = catalog.find("zlib");
+        ASSERT_TRUE(package.has_value());
+        ASSERT_EQ((*package)[0], vrsn::semver_view("1.3.1"));
+    }
+    std::filesystem::remove(path);
+}
+
+TEST(binary_catalog_tests, constructor__bad_input__expect_invalid_argument)
+{
+    std::vector<std::byte> bytes = make_writer().to_bytes();
+    EXPECT_THROW(vrsn::binary_catalog_view(std::span(bytes).first(10)), std::invalid_argument);
+    bytes[0] = std::byte('X');
+    EXPECT_THROW(vrsn::binary_catalog_view{ bytes }, std::invalid_argument);
+}
@@ -0,0 +1,109 @@
+#include <arba/vrsn/binary_encoding.hpp>
+#include <gtest/gtest.h>
+
+#include <array>
+
+TEST(binary_encoding_tests, encode_to__small_numver__one_byte)
+{
+    std::array<std::byte, vrsn::max_encoded_numver_size> buffer{};
+    const vrsn::binary_result res = vrsn::encode_to(buffer, vrsn::numver(1, 2, 3));
+    ASSERT_TRUE(res);
+    ASSERT_EQ(res.size, 1);
+    ASSERT_EQ(vrsn::encoded_size(vrsn::numver(1, 2, 3)), 1);
+
+    vrsn::numver version;
+    ASSERT_EQ(vrsn::decode_from(std::span(buffer).first(res.size), version).size, 1);
+    ASSERT_EQ(version, vrsn::numver(1, 2, 3));
+}
+
+TEST(binary_encoding_tests, encode_decode__large_numver__round_trip)
+{
+    std::array<std::byte, vrsn::max_encoded_numver_size> buffer{};
+    for (const vrsn::numver& version : { vrsn::numver(4, 0, 0), vrsn::numver(0, 4, 0), vrsn::numver(0, 0, 8),
+                                         vrsn::numver(300, 70000, 128),
+                                         vrsn::numver(std::numeric_limits<uint64_t>::max(),
+                                                      std::numeric_limits<uint32_t>::max(),
+                                                      std::numeric_limits<uint32_t>::max()) })
+    {
+        const vrsn::binary_result res = vrsn::encode_to(buffer, version);
+        ASSERT_TRUE(res);
+        ASSERT_EQ(res.size, vrsn::encoded_size(version));
+        vrsn::numver decoded;
+        ASSERT_EQ(vrsn::decode_from(buffer, decoded).size, res.size);
+        ASSERT_EQ(decoded, version);
+    }
+}
+
+TEST(binary_encoding_tests, encode_decode__semver__round_trip)
+{
+    std::array<std::byte, 64> buffer{};
+    const vrsn::semver version("1.2.3-alpha.1+build.42");
+    const vrsn::binary_result res = vrsn::encode_to(buffer, version);
+    ASSERT_TRUE(res);
+    ASSERT_EQ(res.size, vrsn::encoded_size(version));
+
+    vrsn::semver_view view;
+    ASSERT_EQ(vrsn::decode_from(buffer, view).size, res.size);
+    ASSERT_EQ(view, vrsn::semver_view(version));
+    ASSERT_EQ(view.build_metadata(), "build.42");
+    ASSERT_EQ(reinterpret_cast<const std::byte*>(view.pre_release().data()), buffer.data() + 5);
+
+    vrsn::semver decoded(0, 0, 0);
+    ASSERT_TRUE(vrsn::decode_from(buffer, decoded));
+    ASSERT_EQ(decoded.build_metadata(), "build.42");
+}
+
+TEST(binary_encoding_tests, decode_from__semver_with_large_strings__storage_reused)
+{
+    std::array<std::byte, 64> buffer{};
+    ASSERT_TRUE(vrsn::encode_to(buffer, vrsn::semver("2.0.0-beta.2+build.7")));
+    vrsn::semver decoded(1, 0, 0, "a-long-pre-release.identifier.1", "a-long-build-metadata.identifier.1");
+    const char* const pre_release_data = decoded.pre_release().data();
+    const char* const build_metadata_data = decoded.build_metadata().data();
+    ASSERT_TRUE(vrsn::decode_from(buffer, decoded));
+    ASSERT_EQ(decoded, vrsn::semver("2.0.0-beta.2"));
+    ASSERT_EQ(decoded.build_metadata(), "build.7");
+    ASSERT_EQ(decoded.pre_release().data(), pre_release_data);
+    ASSERT_EQ(decoded.build_metadata().data(), build_metadata_data);
+}
+
+TEST(binary_encoding_tests, encode_to__buffer_too_small__value_too_large)
+{
+    std::array<std::byte, 4> buffer{};
+    const vrsn::binary_result res = vrsn::encode_to(buffer, vrsn::semver("1.2.3-alpha"));
+    ASSERT_EQ(res.ec, std::errc::value_too_large);
+    ASSERT_EQ(res.size, 0);
+}
+
+TEST(binary_encoding_tests, decode_from__bad_input__invalid_argument)
+{
+    std::array<std::byte, 64> buffer{};
+    const vrsn::binary_result res = vrsn::encode_to(buffer, vrsn::semver("1.2.3-alpha+b"));
+    ASSERT_TRUE(res);
+
+    vrsn::semver_view view;
+    ASSERT_EQ(vrsn::decode_from(std::span(buffer).first(res.size - 1), view).ec, std::errc::invalid_argument);
+    vrsn::numver version;
+    ASSERT_EQ(vrsn::decode_from(buffer, version).ec, std::errc::invalid_argument);
+    ASSERT_EQ(vrsn::decode_from(std::span<const std::byte>(), version).ec, std::errc::invalid_argument);
+
+    buffer[5] = std::byte('_');
+    ASSERT_EQ(vrsn::decode_from(buffer, view).ec, std::errc::invalid_argument);
+}
+
+TEST(binary_encoding_tests, decode_from__minor_overflow__result_out_of_range)
+{
+    const std::array<std::byte, 9> buffer{ std::byte(0x80), std::byte(1),    std::byte(0xFF), std::byte(0xFF),
+                                           std::byte(0xFF), std::byte(0xFF), std::byte(0x1F), std::byte(0) };
+    vrsn::numver version;
+    ASSERT_EQ(vrsn::decode_from(buffer, version).ec, std::errc::result_out_of_range);
+}
+
+TEST(binary_encoding_tests, decode_from__short_form_semver__no_pre_release)
+{
+    std::array<std::byte, 1> buffer{};
+    ASSERT_TRUE(vrsn::encode_to(buffer, vrsn::semver("0.3.7")));
+    vrsn::semver_view view;
+    ASSERT_EQ(vrsn::decode_from(buffer, view).size, 1);
+    ASSERT_EQ(view, vrsn::semver_view("0.3.7"));
+}
@@ -0,0 +1,105 @@
+#include <arba/vrsn/compact_version_set.hpp>
+#include <gtest/gtest.h>
+
+#include <random>
+
+namespace
+{
+
+std::vector<vrsn::semver> make_versions()
+{
+    // Regular patch bumps, pre-releases, build metadata and large gaps.
+    std::vector<vrsn::semver> versions;
+    for (uint64_t major = 0; major < 3; ++major)
+    {
+        for (uint32_t minor = 0; minor < 7; ++minor)
+        {
+            for (uint32_t patch = 0; patch < 25; ++patch)
+                versions.emplace_back(major, minor, patch);
+            versions.emplace_back(major, minor + 1, 0, "rc.1");
+            versions.emplace_back(major, minor + 1, 0, "rc.2", "build.5");
+        }
+    }
+    versions.emplace_back(1000000000000, 4000000000, 100);
+    versions.emplace_back(1000000000000, 4000000000, 200, "alpha");
+    return versions;
+}
+
+} // namespace
+
+TEST(compact_version_set_tests, constructor__default__empty)
+{
+    vrsn::compact_version_set set;
+    ASSERT_TRUE(set.empty());
+    ASSERT_EQ(set.begin(), set.end());
+    ASSERT_EQ(set.lower_bound(vrsn::semver("1.0.0")), 0);
+    ASSERT_FALSE(set.contains(vrsn::semver("1.0.0")));
+}
+
+TEST(compact_version_set_tests, operator_brackets__nominal_case__same_as_sorted_vector)
+{
+    std::vector<vrsn::semver> versions = make_versions();
+    std::shuffle(versions.begin(), versions.end(), std::mt19937(42));
+    const vrsn::compact_version_set set(versions);
+    std::sort(versions.begin(), versions.end());
+    ASSERT_EQ(set.size(), versions.size());
+    for (std::size_t index = 0; index < versions.size(); ++index)
+    {
+        const vrsn::semver_view version = set[index];
+        ASSERT_EQ(version, vrsn::semver_view(versions[index])) << index;
+        ASSERT_EQ(version.build_metadata(), versions[index].build_metadata()) << index;
+    }
+}
+
+TEST(compact_version_set_tests, iteration__nominal_case__same_as_sorted_vector)
+{
+    std::vector<vrsn::semver> versions = make_versions();
+    const vrsn::compact_version_set set(versions);
+    std::sort(versions.begin(), versions.end());
+    std::size_t index = 0;
+    for (const vrsn::semver_view& version : set)
+    {
+        ASSERT_EQ(version.to_semver(), versions[index]) << index;
+        ++index;
+    }
+    ASSERT_EQ(index, versions.size());
+}
+
+TEST(compact_version_set_tests, lower_bound__nominal_case__same_as_std_lower_bound)
+{
+    std::vector<vrsn::semver> versions = make_versions();
+    const vrsn::compact_version_set set(versions);
+    std::sort(versions.begin(), versions.end());
+    std::vector<vrsn::semver> queries = versions;
+    for (std::string_view query :
+         { "0.0.0-0", "0.3.12-alpha", "1.2.99", "2.8.0-rc.1.1", "99.0.0", "1000000000000.4000000000.150" })
+        queries.emplace_back(query);
+    for (const vrsn::semver& query : queries)
+    {
+        const std::size_t expected = std::lower_bound(versions.begin(), versions.end(), query) - versions.begin();
+        ASSERT_EQ(set.lower_bound(query), expected) << std::format("{}", query);
+    }
+    ASSERT_TRUE(set.contains(vrsn::semver("2.3.0-rc.2")));
+    ASSERT_FALSE(set.contains(vrsn::semver("2.3.0-rc.3")));
+    ASSERT_FALSE(set.contains(vrsn::semver("2.3.25")));
+}
+
+TEST(compact_version_set_tests, constructor__duplicates__stored_once)
+{
+    const vrsn::compact_version_set set(
+        { vrsn::semver("1.0.0+a"), vrsn::semver("1.0.0"), vrsn::semver("0.1.0"), vrsn::semver("1.0.0+b") });
+    ASSERT_EQ(set.size(), 2);
+    ASSERT_EQ(set[1].build_metadata(), "a");
+}
+
+TEST(compact_version_set_tests, memory_usage__regular_versions__much_smaller_than_vector)
+{
+    std::vector<vrsn::semver> versions;
+    for (uint32_t minor = 0; minor < 100; ++minor)
+    {
+        for (uint32_t patch = 0; patch < 100; ++patch)
+            versions.emplace_back(1, minor, patch);
+    }
+    const vrsn::compact_version_set set(versions);
+    ASSERT_LT(set.memory_usage() * 10, versions.size() * sizeof(vrsn::semver));
+}
@@ -0,0 +1,143 @@
+#include <arba/vrsn/concurrent_catalog.hpp>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std::string_view_literals;
+
+TEST(concurrent_catalog_tests, set_versions__unsorted__sorted)
+{
+    vrsn::concurrent_catalog catalog;
+    catalog.set_versions("pkg", { vrsn::semver("1.2.0"), vrsn::semver("0.1.0"), vrsn::semver("1.0.0-rc") });
+    auto reader = catalog.make_reader();
+    std::vector<vrsn::semver> expected{ vrsn::semver("0.1.0"), vrsn::semver("1.0.0-rc"), vrsn::semver("1.2.0") };
+    ASSERT_EQ(reader.versions("pkg"), expected);
+    ASSERT_TRUE(reader.versions("other").empty());
+}
+
+TEST(concurrent_catalog_tests, add_version__nominal_case__inserted_in_order)
+{
+    vrsn::concurrent_catalog catalog(1);
+    catalog.add_version("a", vrsn::semver("2.0.0"));
+    catalog.add_version("b", vrsn::semver("1.0.0"));
+    catalog.add_version("a", vrsn::semver("1.5.0"));
+    auto reader = catalog.make_reader();
+    std::vector<vrsn::semver> expected{ vrsn::semver("1.5.0"), vrsn::semver("2.0.0") };
+    ASSERT_EQ(reader.versions("a"), expected);
+    ASSERT_TRUE(reader.contains("b", vrsn::semver("1.0.0")));
+    ASSERT_FALSE(reader.contains("b", vrsn::semver("1.0.1")));
+    catalog.remove_package("a");
+    ASSERT_FALSE(reader.max("a").has_value());
+    ASSERT_EQ(reader.max("b"), vrsn::semver("1.0.0"));
+}
+
+TEST(concurrent_catalog_tests, max_compatible__nominal_case__ok)
+{
+    vrsn::concurrent_catalog catalog;
+    catalog.set_versions("pkg", { vrsn::semver("1.2.3"), vrsn::semver("1.4.0"), vrsn::semver("1.4.2"),
+                                  vrsn::semver("2.0.0") });
+    auto reader = catalog.make_reader();
+    ASSERT_EQ(reader.max_compatible("pkg", vrsn::numver(1, 2, 0)), vrsn::semver("1.4.2"));
+    ASSERT_EQ(reader.max_compatible("pkg", vrsn::numver(1, 2, 0), vrsn::compatibility::minor), vrsn::semver("1.2.3"));
+    ASSERT_FALSE(reader.max_compatible("pkg", vrsn::numver(3, 0, 0)).has_value());
+}
+
+TEST(concurrent_catalog_tests, reclamation__no_active_reader__replaced_buckets_freed)
+{
+    vrsn::concurrent_catalog<vrsn::numver> catalog;
+    auto reader = catalog.make_reader();
+    for (uint32_t i = 0; i < 100; ++i)
+        catalog.add_version("pkg", vrsn::numver(1, i, 0));
+    ASSERT_EQ(catalog.pending_reclamation_count(), 0);
+    ASSERT_EQ(reader.versions("pkg").size(), 100);
+}
+
+TEST(concurrent_catalog_tests, reclamation__active_reader__replaced_bucket_kept)
+{
+    vrsn::concurrent_catalog<vrsn::numver> catalog;
+    catalog.set_versions("pkg", { vrsn::numver(1, 0, 0) });
+    auto reader = catalog.make_reader();
+    reader.with_versions("pkg",
+                         [&](std::span<const vrsn::numver> versions)
+                         {
+                             catalog.set_versions("pkg", { vrsn::numver(2, 0, 0) });
+                             EXPECT_EQ(catalog.pending_reclamation_count(), 1);
+                             EXPECT_EQ(versions.front(), vrsn::numver(1, 0, 0));
+                         });
+    catalog.add_version("other", vrsn::numver(1, 0, 0));
+    ASSERT_EQ(catalog.pending_reclamation_count(), 0);
+    ASSERT_EQ(reader.max("pkg"), vrsn::numver(2, 0, 0));
+}
+
+TEST(concurrent_catalog_tests, reclamation__nested_read__outer_bucket_kept)
+{
+    vrsn::concurrent_catalog<vrsn::numver> catalog;
+    catalog.set_versions("pkg", { vrsn::numver(1, 0, 0) });
+    auto reader = catalog.make_reader();
+    reader.with_versions("pkg",
+                         [&](std::span<const vrsn::numver> versions)
+                         {
+                             catalog.set_versions("pkg", { vrsn::numver(2, 0, 0) });
+                             EXPECT_EQ(reader.max("pkg"), vrsn::numver(2, 0, 0));
+                             catalog.add_version("other", vrsn::numver(1, 0, 0));
+                             EXPECT_EQ(catalog.pending_reclamation_count(), 1);
+                             EXPECT_EQ(versions.front(), vrsn::numver(1, 0, 0));
+                         });
+    catalog.add_version("other", vrsn::numver(1, 1, 0));
+    ASSERT_EQ(catalog.pending_reclamation_count(), 0);
+}
+
+TEST(concurrent_catalog_tests, readers__concurrent_writer__consistent_snapshots)
+{
+    // The writer publishes lists of n versions whose major is n: a reader seeing a torn or freed list would notice.
+    constexpr unsigned reader_count = 4;
+    constexpr uint64_t update_count = 2000;
+    const std::vector<std::string> package_names{ "a", "b", "c", "d", "e" };
+    vrsn::concurrent_catalog<vrsn::numver> catalog(2);
+    std::atomic<bool> done{ false };
+    std::atomic<bool> inconsistent{ false };
+    {
+        std::vector<std::jthread> readers;
+        for (unsigned i = 0; i < reader_count; ++i)
+        {
+            readers.emplace_back(
+                [&]
+                {
+                    auto reader = catalog.make_reader();
+                    while (!done.load())
+                    {
+                        for (const std::string& name : package_names)
+                        {
+                            reader.with_versions(name,
+                                                 [&](std::span<const vrsn::numver> versions)
+                                                 {
+                                                     if (!std::is_sorted(versions.begin(), versions.end()))
+                                                         inconsistent = true;
+                                                     for (const vrsn::numver& version : versions)
+                                                     {
+                                                         if (version.major() != versions.size())
+                                                             inconsistent = true;
+                                                     }
+                                                 });
+                        }
+                    }
+                });
+        }
+
+        for (uint64_t n = 1; n <= update_count; ++n)
+        {
+            std::vector<vrsn::numver> versions;
+            for (uint64_t i = 0; i < n % 50; ++i)
+                versions.emplace_back(n % 50, static_cast<uint32_t>(n - i), 0);
+            catalog.set_versions(package_names[n % package_names.size()], std::move(versions));
+        }
+        done = true;
+    }
+    ASSERT_FALSE(inconsistent);
+    catalog.add_version("z", vrsn::numver(1, 0, 0));
+    ASSERT_EQ(catalog.pending_reclamation_count(), 0);
+}
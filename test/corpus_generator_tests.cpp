@@ -0,0 +1,112 @@
+#include <arba/vrsn/corpus_generator.hpp>
+#include <arba/vrsn/semver_view.hpp>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <sstream>
+
+namespace
+{
+
+bool is_valid(const std::string& version)
+{
+    vrsn::semver_view view;
+    return vrsn::private_::extract_semver_view_(version, view);
+}
+
+} // namespace
+
+TEST(corpus_generator_tests, generate__same_seed__same_corpus)
+{
+    vrsn::corpus_generator first(vrsn::corpus_profile::npm_like(), 42);
+    vrsn::corpus_generator second(vrsn::corpus_profile::npm_like(), 42);
+    vrsn::corpus_generator third(vrsn::corpus_profile::npm_like(), 43);
+    const std::vector<std::string> versions = first.generate(1000);
+    ASSERT_EQ(versions, second.generate(1000));
+    ASSERT_NE(versions, third.generate(1000));
+}
+
+TEST(corpus_generator_tests, generate__profiles__valid_versions)
+{
+    for (const vrsn::corpus_profile& profile : { vrsn::corpus_profile::npm_like(), vrsn::corpus_profile::cargo_like(),
+                                                 vrsn::corpus_profile::ci_nightly_like() })
+    {
+        vrsn::corpus_generator generator(profile, 7);
+        for (const std::string& version : generator.generate(5000))
+            ASSERT_TRUE(is_valid(version)) << version;
+    }
+}
+
+TEST(corpus_generator_tests, generate__npm_like__skewed_distribution)
+{
+    vrsn::corpus_generator generator(vrsn::corpus_profile::npm_like(), 1);
+    std::size_t pre_release_count = 0;
+    std::size_t zero_major_count = 0;
+    for (const std::string& version : generator.generate(10000))
+    {
+        const vrsn::semver_view view(version);
+        pre_release_count += !view.pre_release().empty();
+        zero_major_count += view.major() == 0;
+    }
+    ASSERT_GT(pre_release_count, 100);
+    ASSERT_LT(pre_release_count, 2000);
+    ASSERT_GT(zero_major_count, 500);
+    ASSERT_LT(zero_major_count, 9500);
+}
+
+TEST(corpus_generator_tests, generate__ci_nightly_like__nightly_pre_releases_with_metadata)
+{
+    vrsn::corpus_generator generator(vrsn::corpus_profile::ci_nightly_like(), 3);
+    std::size_t nightly_count = 0;
+    for (const std::string& version : generator.generate(1000))
+    {
+        const vrsn::semver_view view(version);
+        ASSERT_TRUE(view.build_metadata().starts_with("ci.")) << version;
+        nightly_count += view.pre_release().starts_with("nightly.20");
+    }
+    ASSERT_GT(nightly_count, 500);
+}
+
+TEST(corpus_generator_tests, generate__package_history__increasing_versions)
+{
+    // With a single package, the corpus is the release history of the package.
+    vrsn::corpus_profile profile = vrsn::corpus_profile::cargo_like();
+    profile.package_count = 1;
+    profile.pre_release_ratio = 0.5;
+    vrsn::corpus_generator generator(profile, 5);
+    std::vector<vrsn::semver> versions;
+    for (const std::string& version : generator.generate(2000))
+        versions.emplace_back(version);
+    ASSERT_TRUE(std::ranges::is_sorted(versions));
+    ASSERT_EQ(std::ranges::adjacent_find(versions), versions.end());
+}
+
+TEST(corpus_generator_tests, generate__invalid_ratio__controlled)
+{
+    vrsn::corpus_profile profile = vrsn::corpus_profile::npm_like();
+    profile.invalid_ratio = 0.2;
+    vrsn::corpus_generator generator(profile, 11);
+    const std::vector<std::string> versions = generator.generate(10000);
+    const auto invalid_count = std::ranges::count_if(versions, [](const std::string& version) {
+        return !is_valid(version);
+    });
+    ASSERT_GT(invalid_count, 1800);
+    ASSERT_LT(invalid_count, 2200);
+}
+
+TEST(corpus_generator_tests, write__stream__newline_terminated)
+{
+    vrsn::corpus_generator generator(vrsn::corpus_profile::cargo_like(), 9);
+    vrsn::corpus_generator expected_generator(vrsn::corpus_profile::cargo_like(), 9);
+    std::ostringstream stream;
+    generator.write(stream, 3);
+    const std::vector<std::string> expected = expected_generator.generate(3);
+    ASSERT_EQ(stream.str(), expected[0] + '\n' + expected[1] + '\n' + expected[2] + '\n');
+}
+
+TEST(corpus_generator_tests, constructor__no_package__exception)
+{
+    vrsn::corpus_profile profile;
+    profile.package_count = 0;
+    ASSERT_THROW(vrsn::corpus_generator(profile, 0), std::invalid_argument);
+}
@@ -0,0 +1,87 @@
+#include <arba/vrsn/feature_matrix.hpp>
+#include <arba/vrsn/semver.hpp>
+#include <gtest/gtest.h>
+
+namespace
+{
+
+enum class protocol_feature
+{
+    compression,
+    streaming,
+    legacy_auth,
+};
+
+using protocol_features =
+    vrsn::feature_matrix<protocol_feature, vrsn::feature<protocol_feature::streaming, vrsn::vtag<2, 0, 0>>,
+                         vrsn::feature<protocol_feature::compression, vrsn::vtag<1, 2, 0>>,
+                         vrsn::feature<protocol_feature::legacy_auth, vrsn::vtag<1, 0, 0>, vrsn::vtag<3, 0, 0>>>;
+
+constexpr auto features_1_5 = protocol_features::set_of<vrsn::vtag<1, 5, 0>>;
+static_assert(features_1_5.test(protocol_feature::compression));
+static_assert(!features_1_5.test(protocol_feature::streaming));
+static_assert(features_1_5.test(protocol_feature::legacy_auth));
+static_assert(protocol_features::set_of<vrsn::vtag<0, 9, 0>>.none());
+static_assert(!protocol_features::set_of<vrsn::vtag<3, 0, 0>>.test(protocol_feature::legacy_auth));
+static_assert(protocol_features::all.count() == 3);
+
+} // namespace
+
+TEST(feature_matrix_tests, evaluate__runtime_numver__expected_features)
+{
+    const auto features = protocol_features::evaluate(vrsn::numver("2.3.1"));
+    ASSERT_TRUE(features.test(protocol_feature::compression));
+    ASSERT_TRUE(features.test(protocol_feature::streaming));
+    ASSERT_TRUE(features.test(protocol_feature::legacy_auth));
+    ASSERT_EQ(features, protocol_features::all);
+
+    const auto recent_features = protocol_features::evaluate(vrsn::numver(3, 0, 0));
+    ASSERT_FALSE(recent_features.test(protocol_feature::legacy_auth));
+    ASSERT_EQ(recent_features.count(), 2);
+    ASSERT_TRUE(features.contains(recent_features));
+    ASSERT_FALSE(recent_features.contains(features));
+}
+
+TEST(feature_matrix_tests, evaluate__bounds__introduced_included_removed_excluded)
+{
+    ASSERT_FALSE(protocol_features::evaluate(vrsn::numver(1, 1, 99)).test(protocol_feature::compression));
+    ASSERT_TRUE(protocol_features::evaluate(vrsn::numver(1, 2, 0)).test(protocol_feature::compression));
+    ASSERT_TRUE(protocol_features::evaluate(vrsn::numver(2, 99, 0)).test(protocol_feature::legacy_auth));
+    ASSERT_FALSE(protocol_features::evaluate(vrsn::numver(3, 0, 0)).test(protocol_feature::legacy_auth));
+}
+
+TEST(feature_matrix_tests, evaluate__semver__core_considered)
+{
+    const auto features = protocol_features::evaluate(vrsn::semver("2.0.0-rc.1"));
+    ASSERT_TRUE(features.test(protocol_feature::streaming));
+}
+
+TEST(feature_matrix_tests, introduced_removed__ok)
+{
+    ASSERT_EQ(protocol_features::introduced(protocol_feature::compression), vrsn::numver(1, 2, 0));
+    ASSERT_EQ(protocol_features::removed(protocol_feature::compression), std::nullopt);
+    ASSERT_EQ(protocol_features::removed(protocol_feature::legacy_auth), vrsn::numver(3, 0, 0));
+}
+
+TEST(feature_matrix_tests, feature_set__combinations__ok)
+{
+    using set_type = protocol_features::set_type;
+    set_type lhs, rhs;
+    lhs.set(protocol_feature::compression).set(protocol_feature::streaming);
+    rhs.set(protocol_feature::streaming).set(protocol_feature::legacy_auth);
+    ASSERT_EQ((lhs & rhs).count(), 1);
+    ASSERT_TRUE((lhs & rhs).test(protocol_feature::streaming));
+    ASSERT_EQ(lhs | rhs, protocol_features::all);
+}
+
+TEST(feature_matrix_tests, feature_set__many_features__ok)
+{
+    enum class id : unsigned
+    {
+    };
+    vrsn::feature_set<id, 130> features;
+    features.set(id(0)).set(id(64)).set(id(129));
+    ASSERT_TRUE(features.test(id(129)));
+    ASSERT_FALSE(features.test(id(128)));
+    ASSERT_EQ(features.count(), 3);
+}
@@ -0,0 +1,66 @@
+#include <arba/vrsn/find_versions.hpp>
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+namespace
+{
+
+std::vector<std::string_view> found_tokens(std::string_view text)
+{
+    std::vector<std::string_view> tokens;
+    for (const vrsn::version_match& match : vrsn::find_versions(text))
+        tokens.push_back(match.text);
+    return tokens;
+}
+
+} // namespace
+
+TEST(find_versions_tests, find_versions__build_log__all_versions)
+{
+    constexpr std::string_view text = "Installing openssl-3.0.13 and zlib v1.3.1 (requires cmake>=3.26.0).\n"
+                                      "FROM alpine:3.19.1\n"
+                                      "\"arba-vrsn\": \"0.4.1-rc.1+20240101\", done in 1.5s.";
+    const std::vector<vrsn::version_match> matches = vrsn::find_versions(text);
+    ASSERT_EQ(matches.size(), 5);
+    ASSERT_EQ(matches[0].text, "3.0.13");
+    ASSERT_EQ(matches[0].offset, text.find("3.0.13"));
+    ASSERT_EQ(matches[1].text, "v1.3.1");
+    ASSERT_EQ(matches[1].version, vrsn::semver_view("1.3.1"));
+    ASSERT_EQ(matches[2].text, "3.26.0");
+    ASSERT_EQ(matches[3].text, "3.19.1");
+    ASSERT_EQ(matches[4].version.pre_release(), "rc.1");
+    ASSERT_EQ(matches[4].version.build_metadata(), "20240101");
+}
+
+TEST(find_versions_tests, find_versions__glued_tokens__no_match)
+{
+    ASSERT_TRUE(found_tokens("x1.2.3").empty());
+    ASSERT_TRUE(found_tokens("1.2.3.4").empty());
+    ASSERT_TRUE(found_tokens("1.2.3_4").empty());
+    ASSERT_TRUE(found_tokens("1.2").empty());
+    ASSERT_TRUE(found_tokens("01.2.3").empty());
+    ASSERT_TRUE(found_tokens("1.2.3-beta..1").empty());
+    ASSERT_TRUE(found_tokens("dev1.0.0").empty());
+}
+
+TEST(find_versions_tests, find_versions__boundaries__trimmed_tokens)
+{
+    ASSERT_EQ(found_tokens("version 1.2.3."), (std::vector<std::string_view>{ "1.2.3" }));
+    ASSERT_EQ(found_tokens("1.2.3-"), (std::vector<std::string_view>{ "1.2.3" }));
+    ASSERT_EQ(found_tokens("1.0.0,2.0.0;V3.0.0"), (std::vector<std::string_view>{ "1.0.0", "2.0.0", "V3.0.0" }));
+    ASSERT_EQ(found_tokens("pkg-v2.0.0-alpha"), (std::vector<std::string_view>{ "v2.0.0-alpha" }));
+}
+
+TEST(find_versions_tests, find_versions__long_text__same_as_short_text)
+{
+    std::string text(1000, ' ');
+    text += "a 10.20.30 b";
+    text += std::string(37, '.');
+    text += " 4.5.6";
+    const std::vector<vrsn::version_match> matches = vrsn::find_versions(text);
+    ASSERT_EQ(matches.size(), 2);
+    ASSERT_EQ(matches[0].offset, 1002);
+    ASSERT_EQ(matches[1].text, "4.5.6");
+}
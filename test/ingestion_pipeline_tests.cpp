@@ -0,0 +1,131 @@
+#include <arba/vrsn/ingestion_pipeline.hpp>
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+class string_source : public vrsn::ingestion_source
+{
+public:
+    string_source(std::string text, std::size_t chunk_size) : text_(std::move(text)), chunk_size_(chunk_size) {}
+
+    std::optional<std::string> next_chunk() override
+    {
+        if (pos_ >= text_.size())
+            return std::nullopt;
+        std::string chunk = text_.substr(pos_, chunk_size_);
+        pos_ += chunk.size();
+        return chunk;
+    }
+
+private:
+    std::string text_;
+    std::size_t chunk_size_;
+    std::size_t pos_ = 0;
+};
+
+class failing_sink : public vrsn::ingestion_sink
+{
+public:
+    void consume(std::vector<vrsn::semver>) override { throw std::runtime_error("sink failure"); }
+};
+
+} // namespace
+
+TEST(ingestion_pipeline_tests, ingest__manifest__valid_unique_versions_in_order)
+{
+    string_source source("lib-a 1.2.3\nlib-b = \"2.0.0-rc.1+build.5\"\nlib-c 1.2\nlib-a 1.2.3\nlib-d 1.2.3+other\n", 7);
+    vrsn::memory_sink sink;
+    const vrsn::ingestion_stats stats = vrsn::ingest(source, sink, { .thread_count = 2, .queue_capacity = 1 });
+    const std::vector<vrsn::semver>& versions = sink.versions();
+    ASSERT_EQ(versions.size(), 3);
+    ASSERT_EQ(versions[0], vrsn::semver("1.2.3"));
+    ASSERT_EQ(versions[1], vrsn::semver("2.0.0-rc.1"));
+    ASSERT_EQ(versions[1].build_metadata(), "build.5");
+    ASSERT_EQ(versions[2].build_metadata(), "other");
+    ASSERT_EQ(stats.token_count, 5);
+    ASSERT_EQ(stats.invalid_count, 1);
+    ASSERT_EQ(stats.duplicate_count, 1);
+    ASSERT_EQ(stats.version_count, 3);
+}
+
+TEST(ingestion_pipeline_tests, ingest__prefixed_versions__same_versions_as_find_versions)
+{
+    const std::string text = "zlib-1.2.3 openssl-3.0.13,v1.2.4 (V2.0.0-rc.1). x1.0.0 lib_2.0.0 2.0.0_x v3.0.0-";
+    std::vector<vrsn::semver> expected_versions;
+    for (const vrsn::version_match& match : vrsn::find_versions(text))
+        expected_versions.push_back(match.version.to_semver());
+    ASSERT_EQ(expected_versions.size(), 5);
+    ASSERT_EQ(expected_versions.front(), vrsn::semver("1.2.3"));
+    for (std::size_t chunk_size : { 1, 2, 3, 5, 8, 13, 100 })
+    {
+        string_source source(text, chunk_size);
+        vrsn::memory_sink sink;
+        const vrsn::ingestion_stats stats = vrsn::ingest(source, sink, { .thread_count = 2 });
+        ASSERT_EQ(sink.versions(), expected_versions) << chunk_size;
+        ASSERT_EQ(stats.invalid_count, 0) << chunk_size;
+    }
+}
+
+TEST(ingestion_pipeline_tests, ingest__overlong_run__skipped)
+{
+    string_source source("1.0.0 " + std::string(100, '1') + ".0.0 " + std::string(5000, 'a') + "2.0.0 v3.0.0", 64);
+    vrsn::memory_sink sink;
+    const vrsn::ingestion_stats stats = vrsn::ingest(source, sink, { .thread_count = 2, .max_token_size = 32 });
+    ASSERT_EQ(sink.versions(), std::vector<vrsn::semver>({ vrsn::semver("1.0.0"), vrsn::semver("3.0.0") }));
+    ASSERT_EQ(stats.token_count, 2);
+}
+
+TEST(ingestion_pipeline_tests, ingest__file_source__ok)
+{
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "arba_vrsn_ingestion_tests.txt";
+    {
+        std::ofstream stream(path);
+        for (unsigned i = 0; i < 20000; ++i)
+            stream << std::format("pkg-{} {}.{}.{}\n", i, i % 7, i % 13, i % 101);
+    }
+    vrsn::memory_sink sink;
+    {
+        vrsn::file_source source(path, 1000);
+        const vrsn::ingestion_stats stats = vrsn::ingest(source, sink, { .thread_count = 4 });
+        ASSERT_EQ(stats.chunk_count, (std::filesystem::file_size(path) + 999) / 1000);
+        ASSERT_EQ(stats.invalid_count, 20000);
+        ASSERT_EQ(stats.version_count + stats.duplicate_count, 20000);
+    }
+    std::filesystem::remove(path);
+    // 7, 13 and 101 are coprime: 7 * 13 * 101 distinct versions, the first ones in input order.
+    const std::vector<vrsn::semver>& versions = sink.versions();
+    ASSERT_EQ(versions.size(), 7 * 13 * 101);
+    for (unsigned i = 0; i < versions.size(); ++i)
+        ASSERT_EQ(versions[i], vrsn::semver(i % 7, i % 13, i % 101));
+}
+
+TEST(ingestion_pipeline_tests, ingest__single_thread__ok)
+{
+    string_source source("1.0.0 1.0.1 1.0.0 2.0.0", 1);
+    vrsn::memory_sink sink;
+    const vrsn::ingestion_stats stats = vrsn::ingest(source, sink, { .thread_count = 1, .queue_capacity = 1 });
+    ASSERT_EQ(stats.version_count, 3);
+    ASSERT_EQ(sink.versions().back(), vrsn::semver("2.0.0"));
+}
+
+TEST(ingestion_pipeline_tests, ingest__failing_sink__exception)
+{
+    std::string text;
+    for (unsigned i = 0; i < 10000; ++i)
+        text += std::format("{}.0.0 ", i);
+    string_source source(std::move(text), 16);
+    failing_sink sink;
+    ASSERT_THROW(vrsn::ingest(source, sink, { .thread_count = 2, .queue_capacity = 1 }), std::runtime_error);
+}
+
+TEST(ingestion_pipeline_tests, file_source__missing_file__exception)
+{
+    ASSERT_THROW(vrsn::file_source("/nonexistent/arba_vrsn_ingestion_tests.txt"), std::runtime_error);
+}
@@ -0,0 +1,30 @@
+#include <gtest/gtest.h>
+
+#include <format>
+#include <string>
+
+import arba.vrsn;
+
+// Built with -DARBA_VRSN_BUILD_MODULE=ON: the versions are used through the arba.vrsn module only.
+
+TEST(module_import_tests, format__semver__ok)
+{
+    const arba::vrsn::semver version("0.1.0-dev+metadata");
+    ASSERT_EQ(std::format("version-{}", version), "version-0.1.0-dev+metadata");
+}
+
+TEST(module_import_tests, format__numver_and_semver_view__ok)
+{
+    ASSERT_EQ(std::format("{}", arba::vrsn::numver(1, 2, 3)), "1.2.3");
+    ASSERT_EQ(std::format("{}", arba::vrsn::semver_view("1.2.3-rc.1")), "1.2.3-rc.1");
+}
+
+TEST(module_import_tests, to_chars__bumped_semver__ok)
+{
+    arba::vrsn::semver version("1.4.2");
+    version.up_minor();
+    std::string text(arba::vrsn::max_formatted_size(version), '\0');
+    text.resize(arba::vrsn::to_chars(text.data(), text.data() + text.size(), version).ptr - text.data());
+    ASSERT_EQ(text, "1.5.0");
+    ASSERT_TRUE(arba::vrsn::is_minor_compatible_with(version, arba::vrsn::semver("1.5.3")));
+}
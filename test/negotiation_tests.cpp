@@ -0,0 +1,138 @@
+#include <arba/vrsn/negotiation.hpp>
+#include <gtest/gtest.h>
+
+#include <array>
+#include <vector>
+
+namespace
+{
+
+std::vector<vrsn::numver> versions(std::initializer_list<const char*> strs)
+{
+    std::vector<vrsn::numver> result;
+    for (const char* str : strs)
+        result.emplace_back(str);
+    return result;
+}
+
+// Reference: nested loops over all the pairs.
+bool brute_force_negotiate(const std::vector<vrsn::numver>& local, const std::vector<vrsn::numver>& remote,
+                           vrsn::compatibility policy, vrsn::numver& best)
+{
+    bool found = false;
+    for (const vrsn::numver& lv : local)
+    {
+        for (const vrsn::numver& rv : remote)
+        {
+            const vrsn::numver& newer = std::max(lv, rv);
+            const vrsn::numver& older = std::min(lv, rv);
+            if (vrsn::is_compatible_with(newer, older, policy) && (!found || best < older))
+            {
+                best = older;
+                found = true;
+            }
+        }
+    }
+    return found;
+}
+
+} // namespace
+
+static_assert(vrsn::negotiate(std::array{ vrsn::numver(1, 0, 0), vrsn::numver(2, 1, 0) },
+                              std::array{ vrsn::numver(2, 0, 3) }, vrsn::compatibility::major)
+                  ->agreed
+              == vrsn::numver(2, 0, 3));
+
+TEST(negotiation_tests, negotiate__major__highest_common_major)
+{
+    const auto local = versions({ "1.0.0", "1.2.0", "2.0.0" });
+    const auto remote = versions({ "1.5.0", "3.0.0" });
+    const auto result = vrsn::negotiate(local, remote, vrsn::compatibility::major);
+    ASSERT_TRUE(result.has_value());
+    ASSERT_EQ(result->local, vrsn::numver(1, 2, 0));
+    ASSERT_EQ(result->remote, vrsn::numver(1, 5, 0));
+    ASSERT_EQ(result->agreed, vrsn::numver(1, 2, 0));
+}
+
+TEST(negotiation_tests, negotiate__minor_and_exact__ok)
+{
+    const auto local = versions({ "1.1.4", "1.2.0", "1.3.1" });
+    const auto remote = versions({ "1.1.0", "1.3.0", "1.4.0" });
+    ASSERT_EQ(vrsn::negotiate(local, remote, vrsn::compatibility::minor)->agreed, vrsn::numver(1, 3, 0));
+    ASSERT_EQ(vrsn::negotiate(local, remote, vrsn::compatibility::patch), std::nullopt);
+    const auto exact_remote = versions({ "1.1.4", "1.2.0", "2.0.0" });
+    ASSERT_EQ(vrsn::negotiate(local, exact_remote, vrsn::compatibility::patch)->agreed, vrsn::numver(1, 2, 0));
+}
+
+TEST(negotiation_tests, negotiate__no_common_version__none)
+{
+    ASSERT_EQ(vrsn::negotiate(versions({ "1.0.0" }), versions({ "2.0.0" }), vrsn::compatibility::major), std::nullopt);
+    ASSERT_EQ(vrsn::negotiate({}, versions({ "2.0.0" }), vrsn::compatibility::major), std::nullopt);
+}
+
+TEST(negotiation_tests, negotiate__random_sets__same_as_nested_loops)
+{
+    uint64_t state = 12345;
+    auto random = [&state](uint32_t bound)
+    {
+        state = state * 6364136223846793005 + 1442695040888963407;
+        return static_cast<uint32_t>((state >> 33) % bound);
+    };
+    for (unsigned round = 0; round < 500; ++round)
+    {
+        std::vector<vrsn::numver> local, remote;
+        for (unsigned i = random(20); i > 0; --i)
+            local.emplace_back(random(4), random(4), random(4));
+        for (unsigned i = random(200); i > 0; --i)
+            remote.emplace_back(random(4), random(4), random(4));
+        std::ranges::sort(local);
+        std::ranges::sort(remote);
+        for (vrsn::compatibility policy :
+             { vrsn::compatibility::major, vrsn::compatibility::minor, vrsn::compatibility::patch })
+        {
+            const auto result = vrsn::negotiate(local, remote, policy);
+            vrsn::numver expected;
+            ASSERT_EQ(result.has_value(), brute_force_negotiate(local, remote, policy, expected));
+            if (result)
+            {
+                ASSERT_EQ(result->agreed, expected);
+                ASSERT_TRUE(vrsn::is_compatible_with(std::max(result->local, result->remote), result->agreed, policy));
+            }
+        }
+    }
+}
+
+TEST(negotiation_tests, encode_decode_version_set__round_trip)
+{
+    const auto supported = versions({ "0.1.0", "1.0.0", "1.2.7", "3.0.0", "4096.70000.1" });
+    std::vector<std::byte> buffer(vrsn::encoded_version_set_size(supported));
+    ASSERT_EQ(buffer.size(), 1 + 4 + 7); // count, 4 short forms, header and 2 + 3 + 1 varint bytes
+    const vrsn::binary_result encode_res = vrsn::encode_version_set_to(buffer, supported);
+    ASSERT_TRUE(encode_res);
+    ASSERT_EQ(encode_res.size, buffer.size());
+
+    std::vector<vrsn::numver> decoded;
+    const vrsn::binary_result decode_res = vrsn::decode_version_set_from(buffer, decoded);
+    ASSERT_TRUE(decode_res);
+    ASSERT_EQ(decode_res.size, buffer.size());
+    ASSERT_EQ(decoded, supported);
+}
+
+TEST(negotiation_tests, encode_version_set_to__small_buffer__error)
+{
+    const auto supported = versions({ "1.0.0", "2.0.0" });
+    std::array<std::byte, 2> buffer;
+    ASSERT_EQ(vrsn::encode_version_set_to(buffer, supported).ec, std::errc::value_too_large);
+}
+
+TEST(negotiation_tests, decode_version_set_from__invalid_input__error)
+{
+    const auto unsorted = versions({ "2.0.0", "1.0.0" });
+    std::vector<std::byte> buffer(vrsn::encoded_version_set_size(unsorted));
+    ASSERT_TRUE(vrsn::encode_version_set_to(buffer, unsorted));
+    std::vector<vrsn::numver> decoded;
+    ASSERT_EQ(vrsn::decode_version_set_from(buffer, decoded).ec, std::errc::invalid_argument);
+
+    const std::array truncated{ std::byte(3), std::byte(0) };
+    ASSERT_EQ(vrsn::decode_version_set_from(truncated, decoded).ec, std::errc::invalid_argument);
+}
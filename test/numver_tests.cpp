@@ -264,3 +264,31 @@ TEST(numver_tests, constexpr__valid_args__no_compile_error)
     static_assert(sv != sv2);
     static_assert(sv < sv2);
 }
+
+TEST(numver_tests, to_chars__large_enough_buffer__formatted_string)
+{
+    const vrsn::numver version(18446744073709551615u, 4294967295u, 10);
+    char buffer[vrsn::max_formatted_size(vrsn::numver())];
+    const std::to_chars_result res = vrsn::to_chars(std::begin(buffer), std::end(buffer), version);
+    ASSERT_EQ(res.ec, std::errc{});
+    ASSERT_EQ(std::string_view(buffer, res.ptr), "18446744073709551615.4294967295.10");
+}
+
+TEST(numver_tests, to_chars__too_small_buffer__value_too_large)
+{
+    char buffer[5];
+    const std::to_chars_result res = vrsn::to_chars(std::begin(buffer), std::end(buffer), vrsn::numver(10, 2, 3));
+    ASSERT_EQ(res.ec, std::errc::value_too_large);
+    ASSERT_EQ(res.ptr, std::end(buffer));
+}
+
+TEST(numver_tests, to_chars__constexpr__no_compile_error)
+{
+    constexpr auto chars = []
+    {
+        std::array<char, 8> buffer{};
+        vrsn::to_chars(buffer.data(), buffer.data() + buffer.size(), vrsn::numver(0, 10, 7));
+        return buffer;
+    }();
+    static_assert(std::string_view(chars.data()) == "0.10.7");
+}
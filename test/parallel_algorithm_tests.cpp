@@ -0,0 +1,90 @@
+#include <arba/vrsn/parallel_algorithm.hpp>
+#include <arba/vrsn/semver.hpp>
+#include <gtest/gtest.h>
+
+#include <format>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+constexpr vrsn::parallel_options small_chunks{ .thread_count = 4, .min_chunk_size = 7 };
+
+std::vector<vrsn::semver> make_versions(std::size_t count)
+{
+    std::mt19937 engine(42);
+    std::uniform_int_distribution<unsigned> distribution(0, 4);
+    constexpr std::string_view pre_releases[] = { "", "", "alpha", "alpha.1", "rc.2" };
+    std::vector<vrsn::semver> versions;
+    for (std::size_t i = 0; i < count; ++i)
+        versions.emplace_back(distribution(engine), distribution(engine), distribution(engine),
+                              pre_releases[distribution(engine)], distribution(engine) == 0 ? "meta" : "");
+    return versions;
+}
+
+} // namespace
+
+TEST(parallel_algorithm_tests, parallel_sort__random_versions__same_as_stable_sort)
+{
+    std::vector<vrsn::semver> versions = make_versions(1000);
+    std::vector<vrsn::semver> expected = versions;
+    std::stable_sort(expected.begin(), expected.end());
+
+    vrsn::parallel_sort(std::span(versions), std::less<>(), small_chunks);
+    ASSERT_EQ(versions.size(), expected.size());
+    for (std::size_t i = 0; i < versions.size(); ++i)
+    {
+        ASSERT_EQ(versions[i], expected[i]);
+        ASSERT_EQ(versions[i].build_metadata(), expected[i].build_metadata());
+    }
+}
+
+TEST(parallel_algorithm_tests, parallel_unique__precedence__same_as_unique)
+{
+    std::vector<vrsn::semver> versions = make_versions(1000);
+    vrsn::parallel_sort(std::span(versions), std::less<>(), small_chunks);
+    std::vector<vrsn::semver> expected = versions;
+    expected.erase(std::unique(expected.begin(), expected.end()), expected.end());
+
+    versions.erase(versions.begin() + vrsn::parallel_unique(std::span(versions), vrsn::unique_mode::precedence,
+                                                            small_chunks),
+                   versions.end());
+    ASSERT_EQ(versions, expected);
+}
+
+TEST(parallel_algorithm_tests, parallel_unique__identity__keeps_build_metadata)
+{
+    std::vector<vrsn::semver> versions = { vrsn::semver("1.0.0"), vrsn::semver("1.0.0"), vrsn::semver("1.0.0+a"),
+                                           vrsn::semver("1.0.0+a"), vrsn::semver("2.0.0") };
+    const std::size_t size = vrsn::parallel_unique(std::span(versions), vrsn::unique_mode::identity,
+                                                   { .thread_count = 2, .min_chunk_size = 2 });
+    ASSERT_EQ(size, 3);
+    ASSERT_EQ(versions[1].build_metadata(), "a");
+    ASSERT_EQ(versions[2], vrsn::semver("2.0.0"));
+}
+
+TEST(parallel_algorithm_tests, parallel_max__random_versions__same_as_max_element)
+{
+    const std::vector<vrsn::semver> versions = make_versions(1000);
+    const vrsn::semver* max = vrsn::parallel_max(std::span(versions), small_chunks);
+    ASSERT_NE(max, nullptr);
+    ASSERT_EQ(max, &*std::max_element(versions.begin(), versions.end()));
+    ASSERT_EQ(vrsn::parallel_max(std::span<const vrsn::semver>()), nullptr);
+}
+
+TEST(parallel_algorithm_tests, parallel_max_compatible__numver__greatest_compatible)
+{
+    std::vector<vrsn::numver> versions;
+    for (unsigned i = 0; i < 200; ++i)
+        versions.emplace_back(i % 3, i % 10, i);
+    const vrsn::numver* max =
+        vrsn::parallel_max_compatible(std::span(versions), vrsn::numver(1, 4, 0), vrsn::compatibility::major,
+                                      small_chunks);
+    ASSERT_NE(max, nullptr);
+    ASSERT_EQ(*max, vrsn::numver(1, 9, 199));
+    max = vrsn::parallel_max_compatible(std::span(versions), vrsn::numver(1, 4, 0), vrsn::compatibility::minor,
+                                        small_chunks);
+    ASSERT_EQ(*max, vrsn::numver(1, 4, 184));
+    ASSERT_EQ(vrsn::parallel_max_compatible(std::span(versions), vrsn::numver(3, 0, 0)), nullptr);
+}
@@ -0,0 +1,75 @@
+#include <arba/vrsn/parallel_parse.hpp>
+#include <gtest/gtest.h>
+
+#include <format>
+#include <string>
+
+namespace
+{
+
+std::string make_version_text(std::size_t line_count)
+{
+    std::string text;
+    for (std::size_t i = 0; i < line_count; ++i)
+    {
+        if (i % 97 == 13)
+            text += std::format("{}.x.{}\n", i, i);
+        else if (i % 5 == 0)
+            text += std::format("{}.{}.{}-rc.{}+b{}\n", i / 100, i % 100, i % 7, i % 3, i);
+        else
+            text += std::format("{}.{}.{}\n", i / 100, i % 100, i % 7);
+    }
+    return text;
+}
+
+} // namespace
+
+TEST(parallel_parse_tests, parallel_parse__small_chunks__same_as_sequential)
+{
+    const std::string text = make_version_text(5000);
+
+    std::vector<vrsn::semver> expected_versions;
+    std::vector<std::size_t> expected_error_lines;
+    vrsn::version_lines lines(text);
+    for (const vrsn::version_line& line : lines)
+    {
+        if (line.valid)
+            expected_versions.push_back(line.version.to_semver());
+        else
+            expected_error_lines.push_back(line.line_number);
+    }
+    ASSERT_FALSE(expected_error_lines.empty());
+
+    for (unsigned thread_count : { 1u, 4u })
+    {
+        const auto result = vrsn::parallel_parse(text, { .thread_count = thread_count, .chunk_size = 1000 });
+        ASSERT_EQ(result.versions, expected_versions);
+        ASSERT_EQ(result.errors.size(), expected_error_lines.size());
+        for (std::size_t i = 0; i < result.errors.size(); ++i)
+        {
+            ASSERT_EQ(result.errors[i].line_number, expected_error_lines[i]);
+            ASSERT_EQ(result.errors[i].text, std::format("{}.x.{}", expected_error_lines[i] - 1,
+                                                         expected_error_lines[i] - 1));
+        }
+    }
+}
+
+TEST(parallel_parse_tests, parallel_parse__custom_delimiter__semver_views)
+{
+    constexpr std::string_view text = "1.0.0,2.0.0-beta,,bad,3.1.4";
+    const auto result =
+        vrsn::parallel_parse<vrsn::semver_view>(text, { .delimiter = ',', .thread_count = 2, .chunk_size = 4 });
+    ASSERT_EQ(result.versions.size(), 3);
+    ASSERT_EQ(result.versions[1], vrsn::semver_view("2.0.0-beta"));
+    ASSERT_EQ(result.versions[2], vrsn::semver_view("3.1.4"));
+    ASSERT_EQ(result.errors.size(), 1);
+    ASSERT_EQ(result.errors[0].line_number, 4);
+    ASSERT_EQ(result.errors[0].text, "bad");
+}
+
+TEST(parallel_parse_tests, parallel_parse__empty_text__empty_result)
+{
+    const auto result = vrsn::parallel_parse(std::string_view());
+    ASSERT_TRUE(result.versions.empty());
+    ASSERT_TRUE(result.errors.empty());
+}
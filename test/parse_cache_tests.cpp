@@ -0,0 +1,79 @@
+#include <arba/vrsn/parse_cache.hpp>
+#include <gtest/gtest.h>
+
+#include <format>
+#include <thread>
+#include <vector>
+
+TEST(parse_cache_tests, parse__same_string__hit_and_same_instance)
+{
+    vrsn::parse_cache cache;
+    const auto first = cache.parse("1.2.3-rc.1+build");
+    ASSERT_NE(first, nullptr);
+    ASSERT_EQ(*first, vrsn::semver("1.2.3-rc.1"));
+    ASSERT_EQ(first->build_metadata(), "build");
+    const auto second = cache.parse(std::string("1.2.3-rc.1+build"));
+    ASSERT_EQ(first, second);
+    ASSERT_EQ(cache.hit_count(), 1);
+    ASSERT_EQ(cache.miss_count(), 1);
+    ASSERT_EQ(cache.size(), 1);
+}
+
+TEST(parse_cache_tests, parse__invalid_string__cached_nullptr)
+{
+    vrsn::parse_cache cache;
+    ASSERT_EQ(cache.parse("1.2"), nullptr);
+    ASSERT_EQ(cache.parse("1.2"), nullptr);
+    ASSERT_EQ(cache.hit_count(), 1);
+}
+
+TEST(parse_cache_tests, parse__numver__ok)
+{
+    vrsn::parse_cache<vrsn::numver> cache;
+    ASSERT_EQ(*cache.parse("4.5.6"), vrsn::numver(4, 5, 6));
+    ASSERT_EQ(*cache.parse("4.5.6-rc"), vrsn::numver("4.5.6-rc")); // same as the numver constructor
+    ASSERT_EQ(cache.parse("4.5"), nullptr);
+}
+
+TEST(parse_cache_tests, parse__capacity_exceeded__bounded_size)
+{
+    vrsn::parse_cache cache(8, 1);
+    for (int i = 0; i < 10; ++i)
+        static_cast<void>(cache.parse(std::format("1.0.{}", i)));
+    ASSERT_EQ(cache.size(), 8);
+    static_cast<void>(cache.parse("1.0.9")); // most recently used: kept
+    static_cast<void>(cache.parse("1.0.0")); // least recently used: evicted
+    ASSERT_EQ(cache.hit_count(), 1);
+    ASSERT_EQ(cache.miss_count(), 11);
+    cache.clear();
+    ASSERT_EQ(cache.size(), 0);
+    ASSERT_THROW(vrsn::parse_cache(0), std::invalid_argument);
+}
+
+TEST(parse_cache_tests, parse__concurrent_threads__consistent_results)
+{
+    constexpr unsigned thread_count = 8;
+    constexpr unsigned string_count = 200;
+    vrsn::parse_cache cache(64, 4);
+    std::atomic<bool> wrong_result{ false };
+    {
+        std::vector<std::jthread> threads;
+        for (unsigned t = 0; t < thread_count; ++t)
+        {
+            threads.emplace_back(
+                [&, t]
+                {
+                    for (unsigned i = 0; i < 5000; ++i)
+                    {
+                        const unsigned patch = (i * 7 + t) % string_count;
+                        const auto version = cache.parse(std::format("2.1.{}", patch));
+                        if (!version || *version != vrsn::semver(2, 1, patch))
+                            wrong_result = true;
+                    }
+                });
+        }
+    }
+    ASSERT_FALSE(wrong_result);
+    ASSERT_EQ(cache.hit_count() + cache.miss_count(), thread_count * 5000);
+    ASSERT_LE(cache.size(), cache.capacity());
+}
@@ -0,0 +1,71 @@
+#include <arba/vrsn/plugin_version.hpp>
+#include <gtest/gtest.h>
+
+#include <dlfcn.h>
+
+// Paths of the test plugins (generated by CMake).
+#include "test_plugins.hpp"
+
+static_assert(vrsn::make_version_record("1.2.3-rc.1+build").pre_release() == "rc.1");
+static_assert(vrsn::make_version_record("1.2.3").is_valid());
+
+TEST(plugin_version_tests, is_plugin_compatible__ok)
+{
+    constexpr vrsn::version_record record = vrsn::make_version_record("1.4.0");
+    ASSERT_TRUE(vrsn::is_plugin_compatible(record, vrsn::numver(1, 4, 0)));
+    ASSERT_TRUE(vrsn::is_plugin_compatible(record, vrsn::numver(1, 5, 2)));
+    ASSERT_FALSE(vrsn::is_plugin_compatible(record, vrsn::numver(1, 3, 9)));
+    ASSERT_FALSE(vrsn::is_plugin_compatible(record, vrsn::numver(2, 0, 0)));
+
+    constexpr vrsn::version_record pre_release_record = vrsn::make_version_record("2.0.0-beta.1");
+    ASSERT_TRUE(vrsn::is_plugin_compatible(pre_release_record, vrsn::semver("2.0.0-beta.1")));
+    ASSERT_FALSE(vrsn::is_plugin_compatible(pre_release_record, vrsn::semver("2.0.0")));
+    ASSERT_FALSE(vrsn::is_plugin_compatible(pre_release_record, vrsn::numver(2, 0, 0)));
+}
+
+TEST(plugin_version_tests, make_version_record__too_long_pre_release__exception)
+{
+    ASSERT_THROW(vrsn::make_version_record("1.0.0-" + std::string(48, 'a')), std::invalid_argument);
+    ASSERT_EQ(vrsn::make_version_record("1.0.0-" + std::string(47, 'a')).pre_release().size(), 47);
+}
+
+TEST(plugin_version_tests, read_version_record__exported_record__ok)
+{
+    const std::optional<vrsn::version_record> record = vrsn::read_version_record(VRSN_TEST_PLUGIN_STABLE);
+    ASSERT_TRUE(record.has_value());
+    ASSERT_EQ(record->to_semver_view(), vrsn::semver_view("1.4.0"));
+
+    const std::optional<vrsn::version_record> pre_release_record =
+        vrsn::read_version_record(VRSN_TEST_PLUGIN_PRE_RELEASE);
+    ASSERT_TRUE(pre_release_record.has_value());
+    ASSERT_EQ(pre_release_record->to_semver_view(), vrsn::semver_view("2.0.0-beta.1"));
+}
+
+TEST(plugin_version_tests, read_version_record__static_initializers__not_run)
+{
+    // Loading this plugin would abort.
+    const std::optional<vrsn::version_record> record = vrsn::read_version_record(VRSN_TEST_PLUGIN_ABORT_ON_LOAD);
+    ASSERT_TRUE(record.has_value());
+    ASSERT_TRUE(vrsn::is_plugin_compatible(*record, vrsn::numver(3, 1, 0)));
+}
+
+TEST(plugin_version_tests, read_version_record__no_record__none)
+{
+    ASSERT_FALSE(vrsn::read_version_record(VRSN_TEST_PLUGIN_NO_RECORD).has_value());
+    ASSERT_FALSE(vrsn::read_version_record(__FILE__).has_value());
+}
+
+TEST(plugin_version_tests, find_version_record__loaded_library__ok)
+{
+    void* handle = ::dlopen(VRSN_TEST_PLUGIN_STABLE, RTLD_NOW | RTLD_LOCAL);
+    ASSERT_NE(handle, nullptr) << ::dlerror();
+    const vrsn::version_record* record = vrsn::find_version_record(handle);
+    ASSERT_NE(record, nullptr);
+    ASSERT_TRUE(vrsn::is_plugin_compatible(*record, vrsn::numver(1, 4, 2)));
+    ::dlclose(handle);
+
+    handle = ::dlopen(VRSN_TEST_PLUGIN_NO_RECORD, RTLD_NOW | RTLD_LOCAL);
+    ASSERT_NE(handle, nullptr) << ::dlerror();
+    ASSERT_EQ(vrsn::find_version_record(handle), nullptr);
+    ::dlclose(handle);
+}
@@ -0,0 +1,19 @@
+// Shared library used by plugin_version_tests.
+
+#include <arba/vrsn/plugin_version.hpp>
+
+#include <cstdlib>
+
+#ifdef TEST_PLUGIN_VERSION
+ARBA_VRSN_EXPORT_VERSION_RECORD(TEST_PLUGIN_VERSION);
+#endif
+
+#ifdef TEST_PLUGIN_ABORT_ON_LOAD
+// Reading the version record must not run the static initializers.
+[[maybe_unused]] static const int abort_on_load = (std::abort(), 0);
+#endif
+
+extern "C" ARBA_VRSN_SYMBOL_EXPORT int test_plugin_answer()
+{
+    return 42;
+}
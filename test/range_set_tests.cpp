@@ -0,0 +1,105 @@
+#include <arba/vrsn/range_set.hpp>
+#include <gtest/gtest.h>
+
+namespace
+{
+
+vrsn::version_range between(std::string_view lower, std::string_view upper)
+{
+    return vrsn::version_range::between(vrsn::semver(lower), vrsn::semver(upper));
+}
+
+} // namespace
+
+TEST(range_set_tests, constructor__default__empty)
+{
+    vrsn::range_set set;
+    ASSERT_TRUE(set.is_empty());
+    ASSERT_FALSE(set.contains(vrsn::semver("1.0.0")));
+    ASSERT_EQ(set.to_string(), "<empty>");
+    ASSERT_TRUE(vrsn::range_set::any().is_any());
+}
+
+TEST(range_set_tests, constructor__inclusive_bounds__canonical_form)
+{
+    const vrsn::range_set set(vrsn::version_range(vrsn::semver("1.0.0"), false, vrsn::semver("2.0.0-rc"), true));
+    ASSERT_EQ(set.to_string(), ">=1.0.1-0 <2.0.0-rc.0");
+    ASSERT_FALSE(set.contains(vrsn::semver("1.0.0")));
+    ASSERT_TRUE(set.contains(vrsn::semver("1.0.1-alpha")));
+    ASSERT_TRUE(set.contains(vrsn::semver("2.0.0-rc")));
+    ASSERT_FALSE(set.contains(vrsn::semver("2.0.0-rc.0")));
+    ASSERT_EQ(vrsn::range_set(vrsn::version_range::at_most(vrsn::semver("1.2.3"))),
+              vrsn::range_set(vrsn::version_range::less_than(vrsn::semver("1.2.4-0"))));
+    ASSERT_TRUE(vrsn::range_set(vrsn::version_range::at_least(vrsn::semver("0.0.0-0"))).is_any());
+    ASSERT_TRUE(vrsn::range_set(between("2.0.0", "1.0.0")).is_empty());
+}
+
+TEST(range_set_tests, constructor__below_lowest_version__empty)
+{
+    const vrsn::range_set set(vrsn::version_range::less_than(vrsn::semver("0.0.0-0")));
+    ASSERT_TRUE(set.is_empty());
+    ASSERT_EQ(set, vrsn::range_set());
+    ASSERT_TRUE(set.complement().is_any());
+    ASSERT_TRUE(set.intersect(vrsn::range_set::any()).is_empty());
+    const vrsn::range_set at_least_one{ vrsn::version_range::less_than(vrsn::semver("0.0.0-0")),
+                                        vrsn::version_range::at_least(vrsn::semver("1.0.0")) };
+    ASSERT_EQ(at_least_one, vrsn::range_set(vrsn::version_range::at_least(vrsn::semver("1.0.0"))));
+    ASSERT_EQ(vrsn::range_set(vrsn::version_range::at_least(vrsn::semver("0.0.0-0"))).complement(), vrsn::range_set());
+}
+
+TEST(range_set_tests, unite__overlapping_and_adjacent__merged)
+{
+    const vrsn::range_set set{ between("3.0.0", "4.0.0"), between("1.0.0", "1.5.0"), between("1.2.0", "2.0.0"),
+                               vrsn::version_range::exact(vrsn::semver("2.0.0")) };
+    ASSERT_EQ(set.intervals().size(), 2);
+    ASSERT_EQ(set.to_string(), ">=1.0.0 <2.0.1-0 || >=3.0.0 <4.0.0");
+    ASSERT_TRUE(set.contains(vrsn::semver("2.0.0")));
+    ASSERT_FALSE(set.contains(vrsn::semver("2.5.0")));
+    ASSERT_TRUE(set.contains(vrsn::semver("3.9.9")));
+}
+
+TEST(range_set_tests, intersect__several_intervals__ok)
+{
+    const vrsn::range_set lset{ between("1.0.0", "2.0.0"), between("3.0.0", "4.0.0") };
+    const vrsn::range_set rset{ between("1.5.0", "3.5.0"), vrsn::version_range::at_least(vrsn::semver("3.8.0")) };
+    const vrsn::range_set expected{ between("1.5.0", "2.0.0"), between("3.0.0", "3.5.0"), between("3.8.0", "4.0.0") };
+    ASSERT_EQ(lset.intersect(rset), expected);
+    ASSERT_EQ(rset.intersect(lset), expected);
+    ASSERT_TRUE(lset.intersect(vrsn::range_set()).is_empty());
+    ASSERT_EQ(lset.intersect(vrsn::range_set::any()), lset);
+}
+
+TEST(range_set_tests, intersect__major_compatibility_with_pre_release_boundary__excludes_pre_releases)
+{
+    const vrsn::range_set compatible = vrsn::range_set::compatible_with(vrsn::numver(1, 2, 0),
+                                                                        vrsn::compatibility::major);
+    const vrsn::range_set set =
+        compatible.intersect(vrsn::range_set(vrsn::version_range::at_least(vrsn::semver("1.5.0"))));
+    ASSERT_EQ(set.to_string(), ">=1.5.0 <2.0.0-0");
+    ASSERT_FALSE(set.contains(vrsn::semver("2.0.0-alpha")));
+    ASSERT_TRUE(set.contains(vrsn::semver("1.9.0-beta")));
+}
+
+TEST(range_set_tests, complement__nominal_case__ok)
+{
+    const vrsn::range_set set{ vrsn::version_range::less_than(vrsn::semver("1.0.0")), between("2.0.0", "3.0.0") };
+    const vrsn::range_set complement = set.complement();
+    ASSERT_EQ(complement.to_string(), ">=1.0.0 <2.0.0 || >=3.0.0");
+    ASSERT_EQ(complement.complement(), set);
+    ASSERT_TRUE(set.intersect(complement).is_empty());
+    ASSERT_TRUE(set.unite(complement).is_any());
+    ASSERT_TRUE(vrsn::range_set().complement().is_any());
+    ASSERT_TRUE(vrsn::range_set::any().complement().is_empty());
+}
+
+TEST(range_set_tests, subsumes__nominal_case__ok)
+{
+    const vrsn::range_set set{ between("1.0.0", "2.0.0"), between("3.0.0", "4.0.0") };
+    ASSERT_TRUE(set.subsumes(vrsn::range_set{ between("1.2.0", "1.3.0"), between("3.0.0", "4.0.0") }));
+    ASSERT_FALSE(set.subsumes(vrsn::range_set(between("1.5.0", "3.5.0"))));
+    ASSERT_FALSE(set.subsumes(vrsn::range_set(between("2.0.0", "2.1.0"))));
+    ASSERT_TRUE(set.subsumes(vrsn::range_set()));
+    ASSERT_TRUE(vrsn::range_set::any().subsumes(set));
+    ASSERT_FALSE(set.subsumes(vrsn::range_set::any()));
+    ASSERT_TRUE(set.difference(vrsn::range_set(between("1.0.0", "4.0.0"))).is_empty());
+}
@@ -0,0 +1,168 @@
+#include <arba/vrsn/resolver.hpp>
+#include <gtest/gtest.h>
+
+#include <format>
+
+namespace
+{
+
+vrsn::dependency dep(std::string_view package, std::string_view lower, std::string_view upper)
+{
+    return { std::string(package), vrsn::version_range::between(vrsn::semver(lower), vrsn::semver(upper)) };
+}
+
+} // namespace
+
+TEST(resolver_tests, resolve__no_dependency__root_only)
+{
+    vrsn::memory_package_provider provider;
+    provider.add("root", vrsn::semver("1.0.0"));
+    const vrsn::resolution result = vrsn::resolve(provider, "root", vrsn::semver("1.0.0"));
+    ASSERT_EQ(result.size(), 1);
+    ASSERT_EQ(result.at("root"), vrsn::semver("1.0.0"));
+}
+
+TEST(resolver_tests, resolve__unknown_root_version__exception)
+{
+    vrsn::memory_package_provider provider;
+    provider.add("root", vrsn::semver("1.0.0"));
+    ASSERT_THROW(static_cast<void>(vrsn::resolve(provider, "root", vrsn::semver("2.0.0"))), std::invalid_argument);
+}
+
+TEST(resolver_tests, resolve__compatible_ranges__greatest_versions)
+{
+    vrsn::memory_package_provider provider;
+    provider.add("root", vrsn::semver("1.0.0"),
+                 { dep("a", "1.0.0", "2.0.0"),
+                   { "b", vrsn::version_range::compatible_with(vrsn::numver(1, 1, 0), vrsn::compatibility::major) } });
+    provider.add("a", vrsn::semver("1.0.0"));
+    provider.add("a", vrsn::semver("1.4.0"), { dep("c", "1.0.0", "1.1.0") });
+    provider.add("a", vrsn::semver("2.0.0"));
+    provider.add("b", vrsn::semver("1.0.0"));
+    provider.add("b", vrsn::semver("1.3.2"));
+    provider.add("c", vrsn::semver("1.0.5"));
+    provider.add("c", vrsn::semver("1.1.0"));
+    provider.add("unused", vrsn::semver("1.0.0"));
+
+    const vrsn::resolution result = vrsn::resolve(provider, "root", vrsn::semver("1.0.0"));
+    const vrsn::resolution expected{ { "root", vrsn::semver("1.0.0") },
+                                     { "a", vrsn::semver("1.4.0") },
+                                     { "b", vrsn::semver("1.3.2") },
+                                     { "c", vrsn::semver("1.0.5") } };
+    ASSERT_EQ(result, expected);
+}
+
+TEST(resolver_tests, resolve__conflict_on_greatest_version__backtrack)
+{
+    // foo 1.1.0 requires bar 2, which is incompatible with the root: the solver must learn it and pick foo 1.0.0.
+    vrsn::memory_package_provider provider;
+    provider.add("root", vrsn::semver("1.0.0"), { dep("foo", "1.0.0", "2.0.0"), dep("baz", "1.0.0", "2.0.0") });
+    provider.add("foo", vrsn::semver("1.0.0"), { dep("bar", "1.0.0", "2.0.0") });
+    provider.add("foo", vrsn::semver("1.1.0"), { dep("bar", "2.0.0", "3.0.0") });
+    provider.add("bar", vrsn::semver("1.0.0"));
+    provider.add("bar", vrsn::semver("2.0.0"));
+    provider.add("baz", vrsn::semver("1.0.0"), { dep("bar", "1.0.0", "2.0.0") });
+
+    const vrsn::resolution result = vrsn::resolve(provider, "root", vrsn::semver("1.0.0"));
+    ASSERT_EQ(result.at("foo"), vrsn::semver("1.0.0"));
+    ASSERT_EQ(result.at("bar"), vrsn::semver("1.0.0"));
+    ASSERT_EQ(result.at("baz"), vrsn::semver("1.0.0"));
+}
+
+TEST(resolver_tests, resolve__partial_satisfier__ok)
+{
+    // Example "partial satisfier" of the PubGrub documentation.
+    vrsn::memory_package_provider provider;
+    provider.add("root", vrsn::semver("1.0.0"), { dep("foo", "1.0.0", "2.0.0"), dep("target", "2.0.0", "3.0.0") });
+    provider.add("foo", vrsn::semver("1.0.0"));
+    provider.add("foo", vrsn::semver("1.1.0"), { dep("left", "1.0.0", "2.0.0"), dep("right", "1.0.0", "2.0.0") });
+    provider.add("left", vrsn::semver("1.0.0"), { dep("shared", "1.0.0", "99.0.0") });
+    provider.add("right", vrsn::semver("1.0.0"), { dep("shared", "0.0.0", "2.0.0") });
+    provider.add("shared", vrsn::semver("1.0.0"), { dep("target", "1.0.0", "2.0.0") });
+    provider.add("shared", vrsn::semver("2.0.0"));
+    provider.add("target", vrsn::semver("1.0.0"));
+    provider.add("target", vrsn::semver("2.0.0"));
+
+    const vrsn::resolution result = vrsn::resolve(provider, "root", vrsn::semver("1.0.0"));
+    const vrsn::resolution expected{ { "root", vrsn::semver("1.0.0") },
+                                     { "foo", vrsn::semver("1.0.0") },
+                                     { "target", vrsn::semver("2.0.0") } };
+    ASSERT_EQ(result, expected);
+}
+
+TEST(resolver_tests, resolve__no_solution__explanation)
+{
+    vrsn::memory_package_provider provider;
+    provider.add("root", vrsn::semver("1.0.0"), { dep("foo", "1.0.0", "2.0.0"), dep("bar", "1.0.0", "2.0.0") });
+    provider.add("foo", vrsn::semver("1.0.0"), { dep("shared", "1.0.0", "2.0.0") });
+    provider.add("bar", vrsn::semver("1.0.0"), { dep("shared", "2.0.0", "3.0.0") });
+    provider.add("shared", vrsn::semver("1.0.0"));
+    provider.add("shared", vrsn::semver("2.0.0"));
+
+    try
+    {
+        static_cast<void>(vrsn::resolve(provider, "root", vrsn::semver("1.0.0")));
+        FAIL();
+    }
+    catch (const vrsn::resolution_error& error)
+    {
+        const std::string_view explanation = error.what();
+        ASSERT_NE(explanation.find("foo 1.0.0 depends on shared >=1.0.0 <2.0.0"), std::string_view::npos)
+            << explanation;
+        ASSERT_NE(explanation.find("bar 1.0.0 depends on shared >=2.0.0 <3.0.0"), std::string_view::npos)
+            << explanation;
+        ASSERT_NE(explanation.find("version solving failed."), std::string_view::npos) << explanation;
+    }
+}
+
+TEST(resolver_tests, resolve__missing_dependency__explanation)
+{
+    vrsn::memory_package_provider provider;
+    provider.add("root", vrsn::semver("1.0.0"), { dep("foo", "1.0.0", "2.0.0") });
+    provider.add("foo", vrsn::semver("1.0.0"), { dep("missing", "1.0.0", "2.0.0") });
+
+    try
+    {
+        static_cast<void>(vrsn::resolve(provider, "root", vrsn::semver("1.0.0")));
+        FAIL();
+    }
+    catch (const vrsn::resolution_error& error)
+    {
+        const std::string_view explanation = error.what();
+        ASSERT_NE(explanation.find("foo 1.0.0 depends on missing >=1.0.0 <2.0.0 (no matching version)"),
+                  std::string_view::npos)
+            << explanation;
+    }
+}
+
+TEST(resolver_tests, resolve__synthetic_graph__consistent_selection)
+{
+    // Package i has versions 1.0.0 to 1.9.0, and version 1.m.0 depends on packages 2i+1 and 2i+2 with ranges
+    // excluding their greatest versions when m is odd. (benchmark/resolver_benchmark.cpp times larger graphs.)
+    constexpr std::size_t package_count = 200;
+    vrsn::memory_package_provider provider;
+    const auto name = [](std::size_t i) { return std::format("pkg{}", i); };
+    for (std::size_t i = 0; i < package_count; ++i)
+    {
+        for (uint32_t minor = 0; minor < 10; ++minor)
+        {
+            std::vector<vrsn::dependency> dependencies;
+            for (std::size_t child : { 2 * i + 1, 2 * i + 2 })
+            {
+                if (child >= package_count)
+                    continue;
+                const vrsn::semver upper = minor % 2 ? vrsn::semver(1, 9, 0) : vrsn::semver(2, 0, 0);
+                dependencies.push_back({ name(child), vrsn::version_range::between(vrsn::semver(1, 0, 0), upper) });
+            }
+            provider.add(name(i), vrsn::semver(1, minor, 0), std::move(dependencies));
+        }
+    }
+
+    const vrsn::resolution result = vrsn::resolve(provider, "pkg0", vrsn::semver(1, 9, 0));
+    ASSERT_EQ(result.size(), package_count);
+    for (const auto& [package, version] : result)
+    {
+        for (const vrsn::dependency& dependency : provider.dependencies(package, version))
+            ASSERT_TRUE(dependency.range.contains(result.at(dependency.package))) << package;
+    }
+}
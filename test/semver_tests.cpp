@@ -299,6 +299,16 @@ TEST(semantic_version_tests, operator_lt__normal__no_exception)
     EXPECT_FALSE(vrsn::semver("1.2.3") < vrsn::semver("1.2.3-alpha.6"));
 }
 
+TEST(semantic_version_tests, operator_lt__long_numeric_identifiers__no_overflow)
+{
+    EXPECT_TRUE(vrsn::semver("1.0.0-99999999999999999999") < vrsn::semver("1.0.0-100000000000000000000"));
+    EXPECT_FALSE(vrsn::semver("1.0.0-100000000000000000000") < vrsn::semver("1.0.0-99999999999999999999"));
+    EXPECT_TRUE(vrsn::semver("1.0.0-rc.123456789012345678901") < vrsn::semver("1.0.0-rc.123456789012345678902"));
+    EXPECT_FALSE(vrsn::semver("1.0.0-rc.123456789012345678901") < vrsn::semver("1.0.0-rc.123456789012345678901"));
+    EXPECT_TRUE(vrsn::semver("1.0.0-rc.123456789012345678901") < vrsn::semver("1.0.0-rc.123456789012345678901.1"));
+    EXPECT_TRUE(vrsn::semver("1.0.0-9223372036854775808") < vrsn::semver("1.0.0-alpha"));
+}
+
 TEST(semantic_version_tests, operator_le__normal__no_exception)
 {
     ASSERT_TRUE(vrsn::semver("1.2.3") <= vrsn::semver("1.2.3"));
@@ -396,3 +406,39 @@ TEST(semantic_version_tests, std_format_semver__x_y_z_pr_bm__ctx__no_exception)
     version_str = std::format("{:c-p+b}", version);
     ASSERT_EQ(version_str, "1.2.3-alpha.1+specific-build");
 }
+
+TEST(semantic_version_tests, set_pre_release_and_build_metadata__valid_strings__ok)
+{
+    vrsn::semver version(1, 2, 3, "alpha.1", "build.1");
+    version.set_pre_release("rc.2");
+    version.set_build_metadata("");
+    ASSERT_EQ(version, vrsn::semver("1.2.3-rc.2"));
+    ASSERT_EQ(version.build_metadata(), "");
+    version.set_pre_release("");
+    ASSERT_EQ(version, vrsn::semver("1.2.3"));
+}
+
+TEST(semantic_version_tests, set_pre_release__invalid_string__expect_invalid_argument)
+{
+    vrsn::semver version(1, 2, 3, "alpha.1");
+    ASSERT_THROW(version.set_pre_release("alpha..1"), std::invalid_argument);
+    ASSERT_THROW(version.set_build_metadata("build+1"), std::invalid_argument);
+    ASSERT_EQ(version.pre_release(), "alpha.1");
+}
+
+TEST(semantic_version_tests, to_chars__x_y_z_pr_bm__formatted_string)
+{
+    const vrsn::semver version(1, 2, 3, "alpha.1", "specific-build");
+    std::string buffer(vrsn::max_formatted_size(version), '\0');
+    const std::to_chars_result res = vrsn::to_chars(buffer.data(), buffer.data() + buffer.size(), version);
+    ASSERT_EQ(res.ec, std::errc{});
+    ASSERT_EQ(std::string_view(buffer.data(), res.ptr), "1.2.3-alpha.1+specific-build");
+}
+
+TEST(semantic_version_tests, to_chars__too_small_buffer__value_too_large)
+{
+    const vrsn::semver version(1, 2, 3, "alpha.1", "specific-build");
+    char buffer[16];
+    const std::to_chars_result res = vrsn::to_chars(std::begin(buffer), std::end(buffer), version);
+    ASSERT_EQ(res.ec, std::errc::value_too_large);
+}
@@ -0,0 +1,57 @@
+#include <arba/vrsn/semver_view.hpp>
+#include <gtest/gtest.h>
+
+TEST(semver_view_tests, constructor__valid_string__no_copy)
+{
+    constexpr std::string_view version_str = "1.2.3-alpha.1+build.5";
+    vrsn::semver_view version(version_str);
+    ASSERT_EQ(version.core(), vrsn::numver(1, 2, 3));
+    ASSERT_EQ(version.pre_release(), "alpha.1");
+    ASSERT_EQ(version.build_metadata(), "build.5");
+    ASSERT_EQ(version.pre_release().data(), version_str.data() + 6);
+}
+
+TEST(semver_view_tests, constructor__invalid_string__expect_invalid_argument)
+{
+    EXPECT_THROW(vrsn::semver_view version("1.2.3-alpha..1");, std::invalid_argument);
+    EXPECT_THROW(vrsn::semver_view version("1.2");, std::invalid_argument);
+}
+
+TEST(semver_view_tests, try_parse__valid_and_invalid_strings__ok)
+{
+    static_assert(vrsn::semver_view::try_parse("1.2.3-rc.1")->pre_release() == "rc.1");
+    static_assert(!vrsn::semver_view::try_parse("1.2"));
+    const std::optional<vrsn::semver_view> version = vrsn::semver_view::try_parse("0.4.1+build.5");
+    ASSERT_TRUE(version.has_value());
+    ASSERT_EQ(version->core(), vrsn::numver(0, 4, 1));
+    ASSERT_EQ(version->build_metadata(), "build.5");
+    ASSERT_FALSE(vrsn::semver_view::try_parse("1.2.3-alpha..1").has_value());
+    ASSERT_FALSE(vrsn::semver_view::try_parse("").has_value());
+}
+
+TEST(semver_view_tests, constructor__semver__same_values)
+{
+    const vrsn::semver version("1.2.3-rc.1+abc");
+    const vrsn::semver_view view(version);
+    ASSERT_EQ(view.to_semver(), version);
+    ASSERT_EQ(view.build_metadata(), version.build_metadata());
+}
+
+TEST(semver_view_tests, operator_lt__pre_release__same_precedence_as_semver)
+{
+    constexpr std::string_view versions[] = { "1.0.0-alpha", "1.0.0-alpha.1", "1.0.0-alpha.beta", "1.0.0-beta",
+                                              "1.0.0-beta.2", "1.0.0-beta.11", "1.0.0-rc.1", "1.0.0" };
+    for (std::size_t i = 0; i + 1 < std::size(versions); ++i)
+    {
+        ASSERT_LT(vrsn::semver_view(versions[i]), vrsn::semver_view(versions[i + 1]));
+        ASSERT_FALSE(vrsn::semver_view(versions[i + 1]) < vrsn::semver_view(versions[i]));
+    }
+    ASSERT_EQ(vrsn::semver_view("1.0.0+a"), vrsn::semver_view("1.0.0+b"));
+}
+
+TEST(semver_view_tests, std_format__x_y_z_pr_bm__no_exception)
+{
+    const vrsn::semver_view version("1.2.3-alpha.1+build.5");
+    ASSERT_EQ(std::format("{}", version), "1.2.3-alpha.1+build.5");
+    ASSERT_EQ(std::format("{:c-p}", version), "1.2.3-alpha.1");
+}
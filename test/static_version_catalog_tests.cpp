@@ -0,0 +1,148 @@
+#include <arba/vrsn/static_version_catalog.hpp>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <format>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+
+constexpr auto blocked_versions =
+    vrsn::make_static_version_catalog({ "2.0.0-rc.1", "1.4.2", "0.9.0", "1.4.2+hotfix", "1.10.0", "2.0.0" });
+
+static_assert(blocked_versions.size() == 5);
+static_assert(blocked_versions.contains(vrsn::semver_view("1.4.2")));
+static_assert(blocked_versions.contains(vrsn::semver_view("1.4.2+other")));
+static_assert(!blocked_versions.contains(vrsn::semver_view("1.4.3")));
+static_assert(!blocked_versions.contains(vrsn::semver_view("2.0.0-rc.2")));
+static_assert(blocked_versions.versions().front() == vrsn::semver_view("0.9.0"));
+
+std::vector<std::string> to_strings(std::span<const vrsn::semver_view> versions)
+{
+    std::vector<std::string> strings;
+    for (const vrsn::semver_view& version : versions)
+        strings.push_back(std::format("{}", version.to_semver()));
+    return strings;
+}
+
+// 400 literals "M.m.p" (0 <= M < 8, 0 <= m < 10, 0 <= p < 5), "M.m.p-rc.1" instead when p is odd.
+constexpr std::size_t generated_version_count = 400;
+constexpr std::size_t generated_version_width = 10;
+
+consteval std::array<char, generated_version_count * generated_version_width> generate_version_text()
+{
+    std::array<char, generated_version_count * generated_version_width> text{};
+    for (std::size_t index = 0; index < generated_version_count; ++index)
+    {
+        char* iter = text.data() + index * generated_version_width;
+        for (char component : { char(index / 50), char(index / 5 % 10), char(index % 5) })
+        {
+            *iter++ = '0' + component;
+            *iter++ = '.';
+        }
+        *--iter = '\0'; // the last dot
+        if (index % 5 % 2) // odd patch
+        {
+            for (char ch : { '-', 'r', 'c', '.', '1' })
+                *iter++ = ch;
+        }
+    }
+    return text;
+}
+
+constexpr auto generated_version_text = generate_version_text();
+
+struct generated_versions
+{
+    std::string_view versions[generated_version_count];
+};
+
+consteval generated_versions generate_versions()
+{
+    generated_versions result{};
+    for (std::size_t index = 0; index < generated_version_count; ++index)
+    {
+        const std::string_view slot(generated_version_text.data() + index * generated_version_width,
+                                    generated_version_width);
+        result.versions[index] = slot.substr(0, slot.find('\0'));
+    }
+    return result;
+}
+
+constexpr generated_versions generated_literals = generate_versions();
+
+} // namespace
+
+TEST(static_version_catalog_tests, versions__sorted_and_deduplicated)
+{
+    ASSERT_EQ(to_strings(blocked_versions.versions()),
+              (std::vector<std::string>{ "0.9.0", "1.4.2", "1.10.0", "2.0.0-rc.1", "2.0.0" }));
+}
+
+TEST(static_version_catalog_tests, contains__runtime_versions__ok)
+{
+    ASSERT_TRUE(blocked_versions.contains(vrsn::semver("2.0.0-rc.1")));
+    ASSERT_TRUE(blocked_versions.contains(vrsn::semver_view("1.10.0")));
+    ASSERT_FALSE(blocked_versions.contains(vrsn::semver("1.1.0")));
+    ASSERT_FALSE(blocked_versions.contains(vrsn::semver("2.0.0-rc")));
+}
+
+TEST(static_version_catalog_tests, contains__many_versions__only_members)
+{
+    static constexpr auto catalog = vrsn::make_static_version_catalog(
+        { "0.0.1",  "0.0.2",  "0.1.0",  "0.2.0",  "0.3.0",  "1.0.0-alpha", "1.0.0-beta", "1.0.0",
+          "1.0.1",  "1.0.2",  "1.1.0",  "1.2.0",  "1.2.1",  "1.3.0",       "1.4.0",      "2.0.0-rc.1",
+          "2.0.0",  "2.0.1",  "2.1.0",  "2.2.0",  "2.3.0",  "2.4.0",       "3.0.0",      "3.0.1",
+          "3.1.0",  "3.2.0",  "4.0.0",  "4.1.0",  "5.0.0",  "10.0.0",      "11.0.0",     "12.0.0" });
+    static_assert(catalog.size() == 32);
+    for (uint32_t major = 0; major < 13; ++major)
+    {
+        for (uint32_t minor = 0; minor < 5; ++minor)
+        {
+            for (uint32_t patch = 0; patch < 3; ++patch)
+            {
+                const vrsn::semver_view version{ vrsn::numver(major, minor, patch) };
+                ASSERT_EQ(catalog.contains(version), std::ranges::binary_search(catalog.versions(), version))
+                    << major << '.' << minor << '.' << patch;
+            }
+        }
+    }
+    ASSERT_TRUE(catalog.contains(vrsn::semver_view("1.0.0-beta")));
+    ASSERT_FALSE(catalog.contains(vrsn::semver_view("1.0.0-gamma")));
+}
+
+TEST(static_version_catalog_tests, contains__hundreds_of_versions__only_members)
+{
+    static constexpr auto catalog = vrsn::make_static_version_catalog(generated_literals.versions);
+    static_assert(catalog.size() == generated_version_count);
+    for (const std::string_view literal : generated_literals.versions)
+        ASSERT_TRUE(catalog.contains(vrsn::semver_view(literal))) << literal;
+    ASSERT_TRUE(std::ranges::is_sorted(catalog.versions()));
+    ASSERT_EQ(to_strings(catalog.versions()).front(), "0.0.0");
+    ASSERT_TRUE(catalog.contains(vrsn::semver_view("7.9.3-rc.1")));
+    ASSERT_FALSE(catalog.contains(vrsn::semver_view("7.9.3")));
+    ASSERT_FALSE(catalog.contains(vrsn::semver_view("7.9.4-rc.1")));
+    ASSERT_FALSE(catalog.contains(vrsn::semver_view("8.0.0")));
+}
+
+TEST(static_version_catalog_tests, between__ok)
+{
+    ASSERT_EQ(to_strings(blocked_versions.between(vrsn::semver_view("1.0.0"), vrsn::semver_view("2.0.0"))),
+              (std::vector<std::string>{ "1.4.2", "1.10.0", "2.0.0-rc.1" }));
+    ASSERT_TRUE(blocked_versions.between(vrsn::semver_view("2.0.0"), vrsn::semver_view("1.0.0")).empty());
+}
+
+TEST(static_version_catalog_tests, compatible_with__ok)
+{
+    ASSERT_EQ(to_strings(blocked_versions.compatible_with(vrsn::numver(1, 2, 0), vrsn::compatibility::major)),
+              (std::vector<std::string>{ "1.4.2", "1.10.0" }));
+    ASSERT_EQ(to_strings(blocked_versions.compatible_with(vrsn::numver(1, 4, 0), vrsn::compatibility::minor)),
+              (std::vector<std::string>{ "1.4.2" }));
+    ASSERT_EQ(to_strings(blocked_versions.compatible_with(vrsn::numver(2, 0, 0), vrsn::compatibility::patch)),
+              (std::vector<std::string>{ "2.0.0-rc.1", "2.0.0" }));
+    ASSERT_TRUE(blocked_versions.compatible_with(vrsn::numver(3, 0, 0), vrsn::compatibility::major).empty());
+}
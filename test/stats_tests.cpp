@@ -0,0 +1,82 @@
+#ifndef ARBA_VRSN_ENABLE_STATS
+#define ARBA_VRSN_ENABLE_STATS 1
+#endif
+#ifndef ARBA_VRSN_ENABLE_STATS_TIMING
+#define ARBA_VRSN_ENABLE_STATS_TIMING 1
+#endif
+
+#include <arba/vrsn/semver_view.hpp>
+#include <arba/vrsn/stats.hpp>
+#include <gtest/gtest.h>
+
+#include <thread>
+
+static_assert(vrsn::stats_enabled);
+static_assert(vrsn::stats_timing_enabled);
+// Constant evaluation is not instrumented.
+static_assert(vrsn::semver("1.2.3-rc") < vrsn::semver("1.2.3"));
+
+TEST(stats_tests, parse__valid_and_invalid__counted)
+{
+    const vrsn::stats_snapshot before = vrsn::take_stats_snapshot();
+    const vrsn::numver numver("1.2.3");
+    const vrsn::semver semver("1.2.3-alpha.1+build");
+    ASSERT_THROW(vrsn::numver("1.2"), std::invalid_argument);
+    ASSERT_THROW(vrsn::semver("1.2.3-"), std::invalid_argument);
+    ASSERT_THROW(vrsn::semver(1, 2, 3, "01"), std::invalid_argument);
+    ASSERT_THROW(vrsn::semver(1, 2, 3, "", "a..b"), std::invalid_argument);
+    const vrsn::stats_snapshot stats = vrsn::take_stats_snapshot() - before;
+    ASSERT_EQ(stats[vrsn::stat_counter::numver_parse], 2);
+    ASSERT_EQ(stats[vrsn::stat_counter::invalid_numver], 1);
+    ASSERT_EQ(stats[vrsn::stat_counter::semver_parse], 2);
+    ASSERT_EQ(stats[vrsn::stat_counter::invalid_semver], 1);
+    ASSERT_EQ(stats[vrsn::stat_counter::invalid_pre_release], 1);
+    ASSERT_EQ(stats[vrsn::stat_counter::invalid_build_metadata], 1);
+    ASSERT_GT(stats[vrsn::stat_counter::numver_parse_time], 0);
+    ASSERT_GT(stats[vrsn::stat_counter::semver_parse_time], 0);
+}
+
+TEST(stats_tests, compare__semver_and_view__counted)
+{
+    const vrsn::semver lv("1.2.3-alpha"), rv("1.2.3-beta"), other("2.0.0");
+    const vrsn::stats_snapshot before = vrsn::take_stats_snapshot();
+    ASSERT_TRUE(lv < rv);
+    ASSERT_TRUE(lv < other);
+    ASSERT_FALSE(lv == rv);
+    ASSERT_TRUE(vrsn::semver_view(lv) < vrsn::semver_view(rv));
+    const vrsn::stats_snapshot stats = vrsn::take_stats_snapshot() - before;
+    ASSERT_EQ(stats[vrsn::stat_counter::comparison], 4);
+    ASSERT_EQ(stats[vrsn::stat_counter::pre_release_comparison], 2);
+}
+
+TEST(stats_tests, construct__long_strings__allocations_counted)
+{
+    const std::string long_pre_release(100, 'a');
+    const vrsn::stats_snapshot before = vrsn::take_stats_snapshot();
+    const vrsn::semver version(1, 0, 0, long_pre_release, "b");
+    const vrsn::stats_snapshot stats = vrsn::take_stats_snapshot() - before;
+    ASSERT_EQ(stats[vrsn::stat_counter::allocation], 1);
+    ASSERT_EQ(stats[vrsn::stat_counter::allocated_bytes], 101);
+}
+
+TEST(stats_tests, take_stats_snapshot__exited_threads__kept)
+{
+    const vrsn::stats_snapshot before = vrsn::take_stats_snapshot();
+    std::vector<std::jthread> threads;
+    for (unsigned i = 0; i < 4; ++i)
+    {
+        threads.emplace_back([] {
+            for (unsigned j = 0; j < 1000; ++j)
+                [[maybe_unused]] const vrsn::numver version("1.2.3");
+        });
+    }
+    threads.clear();
+    const vrsn::stats_snapshot stats = vrsn::take_stats_snapshot() - before;
+    ASSERT_EQ(stats[vrsn::stat_counter::numver_parse], 4000);
+}
+
+TEST(stats_tests, stat_counter_name__ok)
+{
+    ASSERT_EQ(vrsn::stat_counter_name(vrsn::stat_counter::numver_parse), "numver_parse");
+    ASSERT_EQ(vrsn::stat_counter_name(vrsn::stat_counter::semver_parse_time), "semver_parse_time");
+}
@@ -0,0 +1,55 @@
+#include <arba/vrsn/version_bitmap.hpp>
+#include <gtest/gtest.h>
+
+namespace
+{
+
+vrsn::version_bitmap make_bitmap(std::initializer_list<std::pair<std::size_t, std::size_t>> runs)
+{
+    vrsn::version_bitmap bitmap;
+    for (const auto& [begin, end] : runs)
+        bitmap.append(begin, end);
+    return bitmap;
+}
+
+} // namespace
+
+TEST(version_bitmap_tests, append__adjacent_runs__merged)
+{
+    vrsn::version_bitmap bitmap = make_bitmap({ { 0, 3 }, { 3, 5 }, { 8, 9 } });
+    bitmap.set(9);
+    ASSERT_EQ(bitmap.runs().size(), 2);
+    ASSERT_EQ(bitmap.count(), 7);
+    ASSERT_TRUE(bitmap.test(4));
+    ASSERT_FALSE(bitmap.test(5));
+    ASSERT_TRUE(bitmap.test(9));
+    ASSERT_EQ(bitmap.lowest_set(), 0);
+    ASSERT_EQ(bitmap.highest_set(), 9);
+    ASSERT_THROW(bitmap.append(2, 4), std::invalid_argument);
+}
+
+TEST(version_bitmap_tests, empty__default__no_highest)
+{
+    vrsn::version_bitmap bitmap;
+    ASSERT_TRUE(bitmap.empty());
+    ASSERT_FALSE(bitmap.highest_set().has_value());
+    ASSERT_EQ(bitmap.count(), 0);
+}
+
+TEST(version_bitmap_tests, operators__nominal_case__ok)
+{
+    const vrsn::version_bitmap lhs = make_bitmap({ { 0, 10 }, { 20, 30 } });
+    const vrsn::version_bitmap rhs = make_bitmap({ { 5, 8 }, { 9, 22 }, { 29, 40 } });
+    ASSERT_EQ(lhs & rhs, make_bitmap({ { 5, 8 }, { 9, 10 }, { 20, 22 }, { 29, 30 } }));
+    ASSERT_EQ(lhs | rhs, make_bitmap({ { 0, 40 } }));
+    ASSERT_EQ(and_not(lhs, rhs), make_bitmap({ { 0, 5 }, { 8, 9 }, { 22, 29 } }));
+    ASSERT_EQ(and_not(rhs, lhs), make_bitmap({ { 10, 20 }, { 30, 40 } }));
+    ASSERT_TRUE((lhs & vrsn::version_bitmap()).empty());
+}
+
+TEST(version_bitmap_tests, for_each__nominal_case__ascending_indices)
+{
+    std::vector<std::size_t> indices;
+    make_bitmap({ { 1, 3 }, { 6, 7 } }).for_each([&](std::size_t index) { indices.push_back(index); });
+    ASSERT_EQ(indices, (std::vector<std::size_t>{ 1, 2, 6 }));
+}
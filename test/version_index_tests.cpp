@@ -0,0 +1,83 @@
+#include <arba/vrsn/version_index.hpp>
+#include <gtest/gtest.h>
+
+namespace
+{
+
+vrsn::version_index make_index()
+{
+    std::vector<vrsn::semver> versions;
+    for (std::string_view version : { "2.0.0", "1.0.0", "1.2.0-rc.1", "1.2.0", "1.4.5", "2.0.0-beta", "2.1.0",
+                                      "3.0.0", "0.9.0" })
+        versions.emplace_back(version);
+    return vrsn::version_index(std::move(versions));
+}
+
+} // namespace
+
+TEST(version_index_tests, constructor__unsorted__sorted)
+{
+    const vrsn::version_index index = make_index();
+    ASSERT_TRUE(std::is_sorted(index.versions().begin(), index.versions().end()));
+    ASSERT_EQ(index[0], vrsn::semver("0.9.0"));
+    ASSERT_EQ(index.all().count(), index.size());
+}
+
+TEST(version_index_tests, compatible_with__nominal_case__same_as_predicate)
+{
+    const vrsn::version_index index = make_index();
+    for (vrsn::compatibility policy :
+         { vrsn::compatibility::major, vrsn::compatibility::minor, vrsn::compatibility::patch })
+    {
+        for (const vrsn::semver& required : index.versions())
+        {
+            const vrsn::version_bitmap bitmap = index.compatible_with(required, policy);
+            ASSERT_EQ(bitmap, index.evaluate_if([&](const vrsn::semver& version)
+                                                { return vrsn::is_compatible_with(version, required, policy); }));
+        }
+    }
+}
+
+TEST(version_index_tests, evaluate__several_constraints__highest)
+{
+    const vrsn::version_index index = make_index();
+    const vrsn::version_bitmap compatible = index.compatible_with(vrsn::numver(1, 1, 0), vrsn::compatibility::major);
+    const vrsn::version_bitmap excluded = index.evaluate(vrsn::version_range::exact(vrsn::semver("1.4.5")));
+    const vrsn::version_bitmap result = and_not(compatible, excluded);
+    ASSERT_EQ(*index.highest(result), vrsn::semver("1.2.0"));
+    ASSERT_EQ(index.highest(index.evaluate(vrsn::version_range::greater_than(vrsn::semver("3.0.0")))), nullptr);
+    const vrsn::range_set set{ vrsn::version_range::less_than(vrsn::semver("1.0.0")),
+                               vrsn::version_range::at_least(vrsn::semver("2.1.0")) };
+    ASSERT_EQ(index.evaluate(set).count(), 3);
+}
+
+TEST(version_bitmap_cache_tests, evaluate__same_range__hit)
+{
+    const vrsn::version_index index = make_index();
+    vrsn::version_bitmap_cache cache(index, 2);
+    const auto first = cache.compatible_with(vrsn::numver(1, 0, 0), vrsn::compatibility::major);
+    const auto second = cache.evaluate(vrsn::range_set(vrsn::version_range::between(vrsn::semver("1.0.0-0"),
+                                                                                       vrsn::semver("2.0.0-0"))));
+    ASSERT_EQ(first, second);
+    ASSERT_EQ(cache.hit_count(), 1);
+    ASSERT_EQ(cache.miss_count(), 1);
+    ASSERT_EQ(*first, index.compatible_with(vrsn::numver(1, 0, 0), vrsn::compatibility::major));
+}
+
+TEST(version_bitmap_cache_tests, evaluate__capacity_exceeded__least_recently_used_evicted)
+{
+    const vrsn::version_index index = make_index();
+    vrsn::version_bitmap_cache cache(index, 2);
+    const auto range = [](std::string_view version)
+    { return vrsn::range_set(vrsn::version_range::at_least(vrsn::semver(version))); };
+    static_cast<void>(cache.evaluate(range("1.0.0")));
+    static_cast<void>(cache.evaluate(range("2.0.0")));
+    static_cast<void>(cache.evaluate(range("1.0.0")));
+    static_cast<void>(cache.evaluate(range("3.0.0"))); // evicts >=2.0.0
+    ASSERT_EQ(cache.size(), 2);
+    static_cast<void>(cache.evaluate(range("1.0.0")));
+    ASSERT_EQ(cache.hit_count(), 2);
+    static_cast<void>(cache.evaluate(range("2.0.0")));
+    ASSERT_EQ(cache.miss_count(), 4);
+    ASSERT_THROW(vrsn::version_bitmap_cache(index, 0), std::invalid_argument);
+}
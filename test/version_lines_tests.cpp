@@ -0,0 +1,102 @@
+#include <arba/vrsn/io/version_lines.hpp>
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+constexpr std::string_view version_text = "1.0.0\n"
+                                          "2.1.0-alpha.1+build\r\n"
+                                          "\n"
+                                          "not-a-version\n"
+                                          "0.10.3";
+
+struct line_record
+{
+    std::size_t line_number;
+    std::string text;
+    bool valid;
+
+    bool operator==(const line_record&) const = default;
+};
+
+const std::vector<line_record> expected_records = {
+    { 1, "1.0.0", true },
+    { 2, "2.1.0-alpha.1+build", true },
+    { 4, "not-a-version", false },
+    { 5, "0.10.3", true },
+};
+
+template <class LineRange>
+std::vector<line_record> read_records(LineRange& lines)
+{
+    std::vector<line_record> records;
+    for (const vrsn::version_line& line : lines)
+        records.push_back({ line.line_number, std::string(line.text), line.valid });
+    return records;
+}
+
+} // namespace
+
+TEST(version_lines_tests, version_lines__text__all_lines)
+{
+    vrsn::version_lines lines(version_text);
+    ASSERT_EQ(read_records(lines), expected_records);
+}
+
+TEST(version_lines_tests, version_lines__text__zero_copy_versions)
+{
+    vrsn::version_lines lines(version_text);
+    auto iter = lines.begin();
+    ++iter;
+    ASSERT_EQ(iter->version, vrsn::semver_view("2.1.0-alpha.1+build"));
+    ASSERT_EQ(iter->version.pre_release().data(), version_text.data() + 12);
+}
+
+TEST(version_lines_tests, version_line_reader__lines_split_across_chunks__same_lines)
+{
+    for (std::size_t buffer_size : { 22, 23, 32, 64 })
+    {
+        std::istringstream stream{ std::string(version_text) };
+        vrsn::version_line_reader reader(stream, buffer_size);
+        ASSERT_EQ(read_records(reader), expected_records);
+    }
+}
+
+TEST(version_lines_tests, version_line_reader__overlong_lines__invalid_lines)
+{
+    std::istringstream stream{ std::string(version_text) };
+    vrsn::version_line_reader reader(stream, 8);
+    const std::vector<line_record> records = read_records(reader);
+    ASSERT_EQ(records.size(), 4);
+    ASSERT_EQ(records[0], expected_records[0]);
+    ASSERT_EQ(records[1].line_number, 2);
+    ASSERT_FALSE(records[1].valid);
+    ASSERT_EQ(records[2].line_number, 4);
+    ASSERT_FALSE(records[2].valid);
+    ASSERT_EQ(records[3], expected_records[3]);
+}
+
+TEST(version_lines_tests, version_line_reader__line_filling_buffer__valid_line)
+{
+    // "1.22.333-rc.1" has 13 characters. The overlong line is truncated to the buffer size.
+    std::istringstream stream{ "1.22.333-rc.1\n0.1.0\n1.22.333-rc.1\n1.22.333-rc.10\n1.22.333-rc.1" };
+    vrsn::version_line_reader reader(stream, 13);
+    const std::vector<line_record> records = read_records(reader);
+    const std::vector<line_record> expected = {
+        { 1, "1.22.333-rc.1", true }, { 2, "0.1.0", true }, { 3, "1.22.333-rc.1", true },
+        { 4, "1.22.333-rc.1", false }, { 5, "1.22.333-rc.1", true },
+    };
+    ASSERT_EQ(records, expected);
+}
+
+TEST(version_lines_tests, version_line_reader__empty_stream__no_line)
+{
+    std::istringstream stream;
+    vrsn::version_line_reader reader(stream);
+    vrsn::version_line line;
+    ASSERT_FALSE(reader.next(line));
+}
@@ -0,0 +1,62 @@
+#include <arba/vrsn/version_range.hpp>
+#include <gtest/gtest.h>
+
+TEST(version_range_tests, constructor__default__any_version)
+{
+    vrsn::version_range range;
+    ASSERT_TRUE(range.is_any());
+    ASSERT_FALSE(range.is_empty());
+    ASSERT_TRUE(range.contains(vrsn::semver("0.0.0-0")));
+    ASSERT_EQ(range.to_string(), "*");
+}
+
+TEST(version_range_tests, contains__bounds__ok)
+{
+    const vrsn::version_range range = vrsn::version_range::between(vrsn::semver("1.2.0"), vrsn::semver("2.0.0"));
+    ASSERT_TRUE(range.contains(vrsn::semver("1.2.0")));
+    ASSERT_TRUE(range.contains(vrsn::semver("1.9.9")));
+    ASSERT_TRUE(range.contains(vrsn::semver("2.0.0-rc.1")));
+    ASSERT_FALSE(range.contains(vrsn::semver("1.2.0-rc.1")));
+    ASSERT_FALSE(range.contains(vrsn::semver("2.0.0")));
+    ASSERT_TRUE(vrsn::version_range::greater_than(vrsn::semver("1.0.0")).contains(vrsn::semver("1.0.1")));
+    ASSERT_FALSE(vrsn::version_range::greater_than(vrsn::semver("1.0.0")).contains(vrsn::semver("1.0.0")));
+    ASSERT_TRUE(vrsn::version_range::at_most(vrsn::semver("1.0.0")).contains(vrsn::semver("1.0.0")));
+    ASSERT_TRUE(vrsn::version_range::exact(vrsn::semver("1.0.0")).contains(vrsn::semver("1.0.0+build")));
+}
+
+TEST(version_range_tests, compatible_with__major__same_as_is_major_compatible_with)
+{
+    const vrsn::numver required(1, 2, 3);
+    const vrsn::version_range range = vrsn::version_range::compatible_with(required, vrsn::compatibility::major);
+    ASSERT_EQ(range.to_string(), ">=1.2.3-0 <2.0.0-0");
+    for (std::string_view version : { "1.2.2", "1.2.3-alpha", "1.2.3", "1.3.0-rc", "1.99.0", "2.0.0-0", "2.0.0" })
+    {
+        const vrsn::semver sv(version);
+        ASSERT_EQ(range.contains(sv), vrsn::is_major_compatible_with(sv, required)) << version;
+    }
+}
+
+TEST(version_range_tests, compatible_with__minor_and_patch__ok)
+{
+    ASSERT_EQ(vrsn::version_range::compatible_with(vrsn::numver(1, 2, 3), vrsn::compatibility::minor).to_string(),
+              ">=1.2.3-0 <1.3.0-0");
+    ASSERT_EQ(vrsn::version_range::compatible_with(vrsn::semver("1.2.3-rc"), vrsn::compatibility::patch).to_string(),
+              ">=1.2.3-0 <1.2.4-0");
+    const vrsn::version_range last_major = vrsn::version_range::compatible_with(
+        vrsn::numver(std::numeric_limits<uint64_t>::max(), 0, 0), vrsn::compatibility::major);
+    ASSERT_FALSE(last_major.upper().has_value());
+}
+
+TEST(version_range_tests, is_empty__nominal_case__ok)
+{
+    ASSERT_FALSE(vrsn::version_range::exact(vrsn::semver("1.0.0")).is_empty());
+    ASSERT_TRUE(vrsn::version_range::between(vrsn::semver("1.0.0"), vrsn::semver("1.0.0")).is_empty());
+    ASSERT_TRUE(vrsn::version_range::between(vrsn::semver("2.0.0"), vrsn::semver("1.0.0")).is_empty());
+}
+
+TEST(version_range_tests, to_string__nominal_case__ok)
+{
+    ASSERT_EQ(vrsn::version_range::exact(vrsn::semver("1.0.0-rc")).to_string(), "=1.0.0-rc");
+    ASSERT_EQ(vrsn::version_range::greater_than(vrsn::semver("1.0.0")).to_string(), ">1.0.0");
+    ASSERT_EQ(vrsn::version_range::at_most(vrsn::semver("1.0.0")).to_string(), "<=1.0.0");
+}
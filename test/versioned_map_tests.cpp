@@ -0,0 +1,97 @@
+#include <arba/vrsn/semver.hpp>
+#include <arba/vrsn/versioned_map.hpp>
+#include <gtest/gtest.h>
+
+#include <string>
+
+namespace
+{
+
+vrsn::versioned_map<vrsn::numver, std::string> make_numver_map()
+{
+    return vrsn::versioned_map<vrsn::numver, std::string>::build({
+        { vrsn::numver(2, 0, 0), "2.0.0" },
+        { vrsn::numver(1, 4, 1), "1.4.1" },
+        { vrsn::numver(1, 2, 0), "1.2.0" },
+        { vrsn::numver(1, 4, 3), "1.4.3" },
+        { vrsn::numver(0, 9, 0), "0.9.0" },
+        { vrsn::numver(1, 4, 1), "duplicate" },
+    });
+}
+
+} // namespace
+
+TEST(versioned_map_tests, build__unsorted_input__sorted_and_deduplicated)
+{
+    const auto map = make_numver_map();
+    ASSERT_EQ(map.size(), 5);
+    ASSERT_TRUE(std::is_sorted(map.begin(), map.end(),
+                               [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; }));
+    const auto iter = map.find_exact(vrsn::numver(1, 4, 1));
+    ASSERT_NE(iter, map.end());
+    ASSERT_EQ(iter->second, "1.4.1");
+}
+
+TEST(versioned_map_tests, find_exact__missing_version__end)
+{
+    const auto map = make_numver_map();
+    ASSERT_EQ(map.find_exact(vrsn::numver(1, 4, 2)), map.end());
+    ASSERT_EQ(map.find_exact(vrsn::numver(3, 0, 0)), map.end());
+}
+
+TEST(versioned_map_tests, find_floor__nominal_case__greatest_lower_or_equal)
+{
+    const auto map = make_numver_map();
+    ASSERT_EQ(map.find_floor(vrsn::numver(1, 4, 2))->second, "1.4.1");
+    ASSERT_EQ(map.find_floor(vrsn::numver(1, 4, 3))->second, "1.4.3");
+    ASSERT_EQ(map.find_floor(vrsn::numver(5, 0, 0))->second, "2.0.0");
+    ASSERT_EQ(map.find_floor(vrsn::numver(0, 1, 0)), map.end());
+}
+
+TEST(versioned_map_tests, find_best_major_compatible__nominal_case__greatest_compatible)
+{
+    const auto map = make_numver_map();
+    ASSERT_EQ(map.find_best_major_compatible(vrsn::numver(1, 0, 0))->second, "1.4.3");
+    ASSERT_EQ(map.find_best_major_compatible(vrsn::numver(1, 4, 2))->second, "1.4.3");
+    ASSERT_EQ(map.find_best_major_compatible(vrsn::numver(0, 9, 0))->second, "0.9.0");
+    ASSERT_EQ(map.find_best_major_compatible(vrsn::numver(1, 5, 0)), map.end());
+    ASSERT_EQ(map.find_best_major_compatible(vrsn::numver(3, 0, 0)), map.end());
+}
+
+TEST(versioned_map_tests, find_best_minor_compatible__nominal_case__greatest_compatible)
+{
+    const auto map = make_numver_map();
+    ASSERT_EQ(map.find_best_minor_compatible(vrsn::numver(1, 4, 0))->second, "1.4.3");
+    ASSERT_EQ(map.find_best_minor_compatible(vrsn::numver(1, 2, 0))->second, "1.2.0");
+    ASSERT_EQ(map.find_best_minor_compatible(vrsn::numver(1, 3, 0)), map.end());
+    ASSERT_EQ(map.find_best_minor_compatible(vrsn::numver(1, 4, 4)), map.end());
+}
+
+TEST(versioned_map_tests, insert_or_assign__new_and_existing_key__sorted)
+{
+    auto map = make_numver_map();
+    auto [iter, inserted] = map.insert_or_assign(vrsn::numver(1, 3, 0), "1.3.0");
+    ASSERT_TRUE(inserted);
+    ASSERT_EQ(iter->second, "1.3.0");
+    std::tie(iter, inserted) = map.insert_or_assign(vrsn::numver(1, 3, 0), "updated");
+    ASSERT_FALSE(inserted);
+    ASSERT_EQ(map.size(), 6);
+    ASSERT_EQ(map.find_floor(vrsn::numver(1, 3, 9))->second, "updated");
+    ASSERT_TRUE(map.erase(vrsn::numver(1, 3, 0)));
+    ASSERT_FALSE(map.erase(vrsn::numver(1, 3, 0)));
+}
+
+TEST(versioned_map_tests, semver_key__pre_release__precedence_order)
+{
+    const auto map = vrsn::versioned_map<vrsn::semver, int>::build({
+        { vrsn::semver("1.1.0"), 3 },
+        { vrsn::semver("1.1.0-beta"), 2 },
+        { vrsn::semver("1.1.0-alpha"), 1 },
+        { vrsn::semver("2.0.0-rc.1"), 4 },
+    });
+    ASSERT_EQ(map.find_exact(vrsn::semver("1.1.0-beta"))->second, 2);
+    ASSERT_EQ(map.find_floor(vrsn::semver("1.1.0-alpha.1"))->second, 1);
+    ASSERT_EQ(map.find_best_major_compatible(vrsn::numver(1, 0, 0))->second, 3);
+    ASSERT_EQ(map.find_best_minor_compatible(vrsn::numver(1, 1, 0))->second, 3);
+    ASSERT_EQ(map.find_best_major_compatible(vrsn::numver(2, 0, 0))->second, 4);
+}
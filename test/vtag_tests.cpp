@@ -69,3 +69,13 @@ TEST(vtag_tests, constexpr__valid_args__no_compile_error)
     static_assert(sv != sv2);
     static_assert(sv < sv2);
 }
+
+TEST(vtag_tests, to_string_view__nominal_case__compile_time_string)
+{
+    static_assert(vrsn::vtag<1, 2, 3>::to_string_view() == "1.2.3");
+    static_assert(vrsn::vtag<18446744073709551615u, 4294967295u, 0>::to_string_view()
+                  == "18446744073709551615.4294967295.0");
+    constexpr std::string_view version_str = vrsn::vtag<10, 0, 99>::to_string_view();
+    EXPECT_EQ(version_str, "10.0.99");
+    EXPECT_EQ(version_str.data()[version_str.size()], '\0');
+}
@@ -0,0 +1,512 @@
+#include <arba/vrsn/binary_encoding.hpp>
+#include <arba/vrsn/io/mapped_file.hpp>
+#include <arba/vrsn/parallel_algorithm.hpp>
+#include <arba/vrsn/parallel_parse.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// vrsn: sort, deduplicate, validate, filter and convert files of semantic versions (one version per line).
+// Files are memory-mapped, the standard input is read through a buffer, and the versions are parsed and processed
+// concurrently. Run `vrsn help` for the usage.
+
+namespace
+{
+
+constexpr std::string_view usage = R"(Usage: vrsn <command> [options] [file...]
+
+Read versions, one per line, from the files (or from the standard input if there is none, or for "-").
+
+Commands:
+  sort           Sort the versions by precedence (stable).
+  unique         Sort the versions and remove duplicates.
+  validate       Print the invalid lines ("file:line: text"), fail if there is one.
+  filter         Print the versions matching --range and/or --compatible-with, in input order.
+  max-per-group  Print the greatest version of each major (or major.minor) version, in ascending order.
+  encode         Write the versions in the binary encoding of arba-vrsn.
+  decode         Read versions in the binary encoding of arba-vrsn and print them.
+
+Options:
+  -j, --threads N          Number of threads (default: 0, the hardware concurrency).
+  -r, --reverse            sort, unique, max-per-group: print in descending order.
+  --identity               unique: also compare the build metadata.
+  --range RANGE            filter: comparators separated by spaces, all of which must match, like
+                           ">=1.2.0 <2.0.0-0". A comparator is "*", VERSION, =VERSION, >VERSION, >=VERSION,
+                           <VERSION or <=VERSION.
+  --compatible-with V      filter: versions compatible with V (see --policy).
+  --policy POLICY          major (default), minor or patch.
+  --by LEVEL               max-per-group: major (default) or minor.
+  --time                   Print the time spent reading, parsing, processing and writing on the standard error.
+
+Invalid lines are reported on the standard error and skipped. The exit status is 0 on success, 1 if an input
+holds invalid lines, and 2 on usage or I/O errors.
+)";
+
+enum class command
+{
+    sort,
+    unique,
+    validate,
+    filter,
+    max_per_group,
+    encode,
+    decode,
+};
+
+// A comparator of a --range expression.
+struct range_comparator
+{
+    enum class op
+    {
+        eq,
+        gt,
+        ge,
+        lt,
+        le,
+    };
+
+    op operation;
+    vrsn::semver bound;
+
+    bool matches(const vrsn::semver_view& version) const
+    {
+        const vrsn::semver_view bound_view(bound);
+        switch (operation)
+        {
+        case op::eq:
+            return version == bound_view;
+        case op::gt:
+            return version > bound_view;
+        case op::ge:
+            return version >= bound_view;
+        case op::lt:
+            return version < bound_view;
+        case op::le:
+            return version <= bound_view;
+        }
+        return false;
+    }
+};
+
+struct options
+{
+    command cmd = command::sort;
+    std::vector<std::string> paths;
+    unsigned thread_count = 0;
+    bool reverse = false;
+    vrsn::unique_mode mode = vrsn::unique_mode::precedence;
+    std::vector<range_comparator> range;
+    bool has_range = false;
+    std::string compatible_with;
+    vrsn::compatibility policy = vrsn::compatibility::major;
+    vrsn::compatibility group_level = vrsn::compatibility::major;
+    bool print_times = false;
+};
+
+class usage_error : public std::invalid_argument
+{
+public:
+    using std::invalid_argument::invalid_argument;
+};
+
+command parse_command(std::string_view name)
+{
+    if (name == "sort")
+        return command::sort;
+    if (name == "unique")
+        return command::unique;
+    if (name == "validate")
+        return command::validate;
+    if (name == "filter")
+        return command::filter;
+    if (name == "max-per-group")
+        return command::max_per_group;
+    if (name == "encode")
+        return command::encode;
+    if (name == "decode")
+        return command::decode;
+    throw usage_error("unknown command '" + std::string(name) + "'");
+}
+
+vrsn::compatibility parse_policy(std::string_view name)
+{
+    if (name == "major")
+        return vrsn::compatibility::major;
+    if (name == "minor")
+        return vrsn::compatibility::minor;
+    if (name == "patch")
+        return vrsn::compatibility::patch;
+    throw usage_error("unknown policy '" + std::string(name) + "'");
+}
+
+vrsn::semver parse_version_argument(std::string_view text)
+{
+    const std::optional<vrsn::semver_view> version = vrsn::semver_view::try_parse(text);
+    if (!version)
+        throw usage_error("invalid version '" + std::string(text) + "'");
+    return version->to_semver();
+}
+
+std::vector<range_comparator> parse_range(std::string_view expression)
+{
+    using enum range_comparator::op;
+    // Longest prefixes first.
+    constexpr std::pair<std::string_view, range_comparator::op> prefixes[] = {
+        { ">=", ge }, { ">", gt }, { "<=", le }, { "<", lt }, { "=", eq }
+    };
+    std::vector<range_comparator> comparators;
+    while (!expression.empty())
+    {
+        const std::size_t begin = expression.find_first_not_of(' ');
+        if (begin == std::string_view::npos)
+            break;
+        expression.remove_prefix(begin);
+        std::string_view token = expression.substr(0, expression.find(' '));
+        expression.remove_prefix(token.size());
+        if (token == "*")
+            continue;
+        range_comparator::op operation = eq;
+        for (const auto& [prefix, prefix_op] : prefixes)
+        {
+            if (token.starts_with(prefix))
+            {
+                token.remove_prefix(prefix.size());
+                operation = prefix_op;
+                break;
+            }
+        }
+        comparators.push_back({ operation, parse_version_argument(token) });
+    }
+    return comparators;
+}
+
+options parse_options(int argc, char** argv)
+{
+    if (argc < 2)
+        throw usage_error("missing command");
+    options opts;
+    opts.cmd = parse_command(argv[1]);
+    for (int index = 2; index < argc; ++index)
+    {
+        const std::string_view arg = argv[index];
+        const auto value = [&]() -> std::string_view
+        {
+            if (index + 1 >= argc)
+                throw usage_error("missing value after '" + std::string(arg) + "'");
+            return argv[++index];
+        };
+        if (arg == "-j" || arg == "--threads")
+            opts.thread_count = static_cast<unsigned>(std::stoul(std::string(value())));
+        else if (arg == "-r" || arg == "--reverse")
+            opts.reverse = true;
+        else if (arg == "--identity")
+            opts.mode = vrsn::unique_mode::identity;
+        else if (arg == "--range")
+        {
+            opts.range = parse_range(value());
+            opts.has_range = true;
+        }
+        else if (arg == "--compatible-with")
+            opts.compatible_with = value();
+        else if (arg == "--policy")
+            opts.policy = parse_policy(value());
+        else if (arg == "--by")
+        {
+            opts.group_level = parse_policy(value());
+            if (opts.group_level == vrsn::compatibility::patch)
+                throw usage_error("max-per-group is by major or minor");
+        }
+        else if (arg == "--time")
+            opts.print_times = true;
+        else if (arg.size() > 1 && arg.starts_with('-'))
+            throw usage_error("unknown option '" + std::string(arg) + "'");
+        else
+            opts.paths.emplace_back(arg);
+    }
+    if (opts.cmd == command::filter && !opts.has_range && opts.compatible_with.empty())
+        throw usage_error("filter requires --range or --compatible-with");
+    if (opts.paths.empty())
+        opts.paths.emplace_back("-");
+    return opts;
+}
+
+// Contents of an input: the mapped file, or the standard input read into a buffer.
+class input
+{
+public:
+    explicit input(const std::string& path) : path_(path == "-" ? "<stdin>" : path)
+    {
+        if (path != "-")
+        {
+            file_ = vrsn::mapped_file(path);
+            return;
+        }
+        std::vector<char> buffer(1024 * 1024);
+        std::size_t read_size;
+        while ((read_size = std::fread(buffer.data(), 1, buffer.size(), stdin)) > 0)
+            stdin_text_.append(buffer.data(), read_size);
+        if (std::ferror(stdin))
+            throw std::runtime_error("cannot read the standard input");
+    }
+
+    const std::string& path() const noexcept { return path_; }
+    std::span<const std::byte> bytes() const noexcept
+    {
+        if (!file_.empty())
+            return file_.bytes();
+        return std::as_bytes(std::span(stdin_text_));
+    }
+    std::string_view text() const noexcept
+    {
+        const std::span<const std::byte> data = bytes();
+        return std::string_view(reinterpret_cast<const char*>(data.data()), data.size());
+    }
+
+private:
+    std::string path_;
+    vrsn::mapped_file file_;
+    std::string stdin_text_;
+};
+
+// Output written to the standard output in large blocks.
+class output
+{
+public:
+    output() { buffer_.reserve(capacity_); }
+    ~output() { flush(); }
+
+    void write(std::string_view text)
+    {
+        if (buffer_.size() + text.size() > capacity_)
+            flush();
+        buffer_.append(text);
+    }
+    void write_line(const vrsn::semver_view& version)
+    {
+        const std::size_t max_size = vrsn::max_formatted_size(version) + 1;
+        if (buffer_.size() + max_size > capacity_)
+            flush();
+        const std::size_t size = buffer_.size();
+        buffer_.resize(size + max_size);
+        char* const end = vrsn::to_chars(buffer_.data() + size, buffer_.data() + buffer_.size(), version).ptr;
+        *end = '\n';
+        buffer_.resize(static_cast<std::size_t>(end + 1 - buffer_.data()));
+    }
+    void flush()
+    {
+        if (!buffer_.empty() && std::fwrite(buffer_.data(), 1, buffer_.size(), stdout) != buffer_.size())
+            throw std::runtime_error("cannot write on the standard output");
+        buffer_.clear();
+    }
+
+private:
+    static constexpr std::size_t capacity_ = 1024 * 1024;
+    std::string buffer_;
+};
+
+class stopwatch
+{
+public:
+    explicit stopwatch(bool enabled) : enabled_(enabled) {}
+
+    void lap(std::string_view step)
+    {
+        if (!enabled_)
+            return;
+        const auto now = std::chrono::steady_clock::now();
+        const std::chrono::duration<double, std::milli> duration = now - last_;
+        std::cerr << "vrsn: " << step << ": " << duration.count() << " ms\n";
+        last_ = now;
+    }
+
+private:
+    bool enabled_;
+    std::chrono::steady_clock::time_point last_ = std::chrono::steady_clock::now();
+};
+
+int run_decode(const options& opts, stopwatch& watch)
+{
+    output out;
+    int status = EXIT_SUCCESS;
+    for (const std::string& path : opts.paths)
+    {
+        const input in(path);
+        watch.lap("read " + in.path());
+        std::span<const std::byte> bytes = in.bytes();
+        while (!bytes.empty())
+        {
+            vrsn::semver_view version;
+            const vrsn::binary_result res = vrsn::decode_from(bytes, version);
+            if (!res)
+            {
+                std::cerr << "vrsn: " << in.path() << ": invalid binary version at offset "
+                          << in.bytes().size() - bytes.size() << '\n';
+                status = 1;
+                break;
+            }
+            out.write_line(version);
+            bytes = bytes.subspan(res.size);
+        }
+        watch.lap("decode " + in.path());
+    }
+    out.flush();
+    watch.lap("write");
+    return status;
+}
+
+int run(const options& opts)
+{
+    stopwatch watch(opts.print_times);
+    if (opts.cmd == command::decode)
+        return run_decode(opts, watch);
+
+    // The parsed versions refer to the inputs, which must outlive them.
+    std::vector<input> inputs;
+    inputs.reserve(opts.paths.size());
+    std::vector<vrsn::semver_view> versions;
+    int status = EXIT_SUCCESS;
+    output out;
+    for (const std::string& path : opts.paths)
+    {
+        const input& in = inputs.emplace_back(path);
+        watch.lap("read " + in.path());
+        vrsn::parallel_parse_result<vrsn::semver_view> result =
+            vrsn::parallel_parse<vrsn::semver_view>(in.text(), { .thread_count = opts.thread_count });
+        watch.lap("parse " + in.path());
+        for (const vrsn::parse_error& error : result.errors)
+        {
+            const std::string message = in.path() + ':' + std::to_string(error.line_number) + ": "
+                                        + std::string(error.text) + '\n';
+            if (opts.cmd == command::validate)
+                out.write(message);
+            else
+                std::cerr << "vrsn: invalid version at " << message;
+        }
+        if (!result.errors.empty())
+            status = 1;
+        if (versions.empty())
+            versions = std::move(result.versions);
+        else
+            versions.insert(versions.end(), result.versions.begin(), result.versions.end());
+    }
+
+    const vrsn::parallel_options parallel{ .thread_count = opts.thread_count };
+    const auto sort_versions = [&]
+    {
+        if (opts.reverse)
+            vrsn::parallel_sort(std::span(versions), std::greater<>(), parallel);
+        else
+            vrsn::parallel_sort(std::span(versions), std::less<>(), parallel);
+    };
+    switch (opts.cmd)
+    {
+    case command::sort:
+        sort_versions();
+        break;
+    case command::unique:
+        sort_versions();
+        versions.resize(vrsn::parallel_unique(std::span(versions), opts.mode, parallel));
+        break;
+    case command::validate:
+        versions.clear();
+        break;
+    case command::filter:
+    {
+        std::optional<vrsn::semver> required;
+        if (!opts.compatible_with.empty())
+            required = parse_version_argument(opts.compatible_with);
+        std::erase_if(versions,
+                      [&](const vrsn::semver_view& version)
+                      {
+                          for (const range_comparator& comparator : opts.range)
+                          {
+                              if (!comparator.matches(version))
+                                  return true;
+                          }
+                          return required && !vrsn::is_compatible_with(version, *required, opts.policy);
+                      });
+        break;
+    }
+    case command::max_per_group:
+    {
+        vrsn::parallel_sort(std::span(versions), std::less<>(), parallel);
+        const auto same_group = [&](const vrsn::semver_view& lv, const vrsn::semver_view& rv)
+        {
+            return lv.major() == rv.major()
+                   && (opts.group_level == vrsn::compatibility::major || lv.minor() == rv.minor());
+        };
+        std::size_t size = 0;
+        for (std::size_t index = 0; index < versions.size(); ++index)
+        {
+            if (index + 1 == versions.size() || !same_group(versions[index], versions[index + 1]))
+                versions[size++] = versions[index];
+        }
+        versions.resize(size);
+        if (opts.reverse)
+            std::ranges::reverse(versions);
+        break;
+    }
+    case command::encode:
+    {
+        watch.lap("process");
+        std::string buffer;
+        for (const vrsn::semver_view& version : versions)
+        {
+            const std::size_t size = buffer.size();
+            buffer.resize(size + vrsn::encoded_size(version));
+            (void)vrsn::encode_to(std::as_writable_bytes(std::span(buffer)).subspan(size), version);
+            if (buffer.size() >= 1024 * 1024)
+            {
+                out.write(buffer);
+                buffer.clear();
+            }
+        }
+        out.write(buffer);
+        out.flush();
+        watch.lap("write");
+        return status;
+    }
+    case command::decode:
+        break;
+    }
+    watch.lap("process");
+
+    for (const vrsn::semver_view& version : versions)
+        out.write_line(version);
+    out.flush();
+    watch.lap("write");
+    return status;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc == 2 && (std::string_view(argv[1]) == "help" || std::string_view(argv[1]) == "--help"))
+    {
+        std::cout << usage;
+        return EXIT_SUCCESS;
+    }
+    try
+    {
+        return run(parse_options(argc, argv));
+    }
+    catch (const usage_error& error)
+    {
+        std::cerr << "vrsn: " << error.what() << "\n\n" << usage;
+    }
+    catch (const std::exception& error)
+    {
+        std::cerr << "vrsn: " << error.what() << '\n';
+    }
+    return 2;
+}